@@ -0,0 +1,86 @@
+#include "headless_bench.h"
+#include "../engine/core/log.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <string>
+
+namespace {
+
+    void printUsage() {
+        spdlog::info("用法: game_bench [--level <tmj>]... [--frames N] [--warmup N] [--dt 秒] [--bodies N] [--config <json>] [--out <json>] [--trace <json>] [--verbose]");
+        spdlog::info("未指定 --level 时测试 assets/maps/level*.tmj（需在仓库根目录运行）。");
+    }
+
+    /// @brief 查找 assets/maps 下所有 level*.tmj，按文件名排序
+    std::vector<std::string> findLevels() {
+        std::vector<std::string> levels;
+        std::error_code ec;
+        for (const auto& entry : std::filesystem::directory_iterator("assets/maps", ec)) {
+            auto file_name = entry.path().filename().string();
+            if (entry.is_regular_file() && file_name.starts_with("level") && entry.path().extension() == ".tmj") {
+                levels.push_back(entry.path().generic_string());
+            }
+        }
+        std::sort(levels.begin(), levels.end());
+        return levels;
+    }
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    spdlog::set_level(spdlog::level::info);
+    bench::BenchOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> const char* { return i + 1 < argc ? argv[++i] : nullptr; };
+        const char* value = nullptr;
+        if (arg == "--verbose") {
+            spdlog::set_level(spdlog::level::debug);
+        }
+        else if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        }
+        else if ((arg == "--level" || arg == "--frames" || arg == "--warmup" || arg == "--dt" || arg == "--bodies" ||
+                  arg == "--config" || arg == "--out" || arg == "--trace") && (value = next())) {
+            if (arg == "--level") options.levels.emplace_back(value);
+            else if (arg == "--frames") options.frames = std::max(1, std::atoi(value));
+            else if (arg == "--warmup") options.warmup_frames = std::max(0, std::atoi(value));
+            else if (arg == "--dt") options.delta_time = static_cast<float>(std::atof(value));
+            else if (arg == "--bodies") options.extra_bodies = static_cast<size_t>(std::max(0, std::atoi(value)));
+            else if (arg == "--config") options.config_path = value;
+            else if (arg == "--trace") options.trace_path = value;
+            else options.output_path = value;
+        }
+        else {
+            spdlog::error("无效的参数: {}", arg);
+            printUsage();
+            return 2;
+        }
+    }
+
+    if (options.levels.empty()) {
+        options.levels = findLevels();
+    }
+    if (options.levels.empty()) {
+        spdlog::error("没有找到关卡文件 (assets/maps/level*.tmj)。");
+        return 2;
+    }
+    if (options.delta_time <= 0.0f) {
+        spdlog::error("--dt 必须大于0。");
+        return 2;
+    }
+
+    // 参数解析完毕后再切换到异步日志，避免运行中的日志输出影响计时
+    engine::core::initLogging(spdlog::get_level());
+    bool success = false;
+    {
+        bench::HeadlessBench bench(std::move(options));
+        success = bench.run();
+    }
+    engine::core::shutdownLogging();
+    return success ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+#include "bench_scene.h"
+#include "../engine/core/context.h"
+#include "../engine/object/game_object.h"
+#include "../engine/object/component_registry.h"
+#include "../engine/component/transform_component.h"
+#include "../engine/component/sprite_component.h"
+#include "../engine/component/physics_component.h"
+#include "../engine/component/collider_component.h"
+#include "../engine/component/animation_component.h"
+#include "../engine/component/health_component.h"
+#include "../engine/component/parallax_component.h"
+#include "../engine/component/tilelayer_component.h"
+#include "../engine/physics/physics_engine.h"
+#include "../engine/physics/collider.h"
+#include "../engine/resource/resource_manager.h"
+#include "../engine/scene/level_loader.h"
+#include "../engine/scene/level_data.h"
+#include <spdlog/spdlog.h>
+#include <random>
+
+namespace bench {
+
+    namespace {
+        constexpr const char* BODY_TEXTURE = "assets/textures/Props/big-crate.png";
+
+        double elapsedMs(std::chrono::steady_clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+    }
+
+    BenchScene::BenchScene(std::string map_path, size_t extra_bodies, engine::core::Context& context, engine::scene::SceneManager& scene_manager)
+        : Scene(map_path, context, scene_manager), map_path_(std::move(map_path)), extra_bodies_(extra_bodies) {
+        registerComponentSystems();
+    }
+
+    void BenchScene::init() {
+        // 与 GameScene 的同步加载路径相同：准备数据 -> 预加载纹理 -> 创建对象
+        engine::scene::LevelLoader level_loader;
+        engine::scene::LevelData data;
+        if (level_loader.prepareLevel(map_path_, data)) {
+            auto manifest = engine::scene::LevelLoader::collectTexturePaths(data);
+            if (extra_bodies_ > 0) manifest.push_back(BODY_TEXTURE);
+            context_.getResourceManager().preloadTextures(manifest);
+            level_loader.buildLevel(data, *this);
+            level_loaded_ = true;
+        }
+        else {
+            spdlog::error("基准测试关卡加载失败: {}", map_path_);
+        }
+        spawnBodies();
+        Scene::init();
+    }
+
+    void BenchScene::update(float delta_time) {
+        if (!is_initialized_) return;
+
+        auto start = std::chrono::steady_clock::now();
+        updatePhysics(delta_time);
+        last_timings_.physics_ms = elapsedMs(start);
+
+        start = std::chrono::steady_clock::now();
+        updateGameObjects(delta_time);
+        last_timings_.scene_update_ms = elapsedMs(start);
+    }
+
+    void BenchScene::registerComponentSystems() {
+        using engine::object::ComponentPhase;
+        auto& registry = getComponentRegistry();
+        registry.registerSystem<engine::component::AnimationComponent>(ComponentPhase::UPDATE);
+        registry.registerSystem<engine::component::HealthComponent>(ComponentPhase::UPDATE);
+        registry.registerSystem<engine::component::SpriteComponent>(ComponentPhase::RENDER);
+        registry.registerSystem<engine::component::ParallaxComponent>(ComponentPhase::RENDER);
+        registry.registerSystem<engine::component::TileLayerComponent>(ComponentPhase::RENDER);
+        registry.registerSystem<engine::component::TransformComponent>(ComponentPhase::NONE);
+        registry.registerSystem<engine::component::PhysicsComponent>(ComponentPhase::NONE);
+        registry.registerSystem<engine::component::ColliderComponent>(ComponentPhase::NONE);
+    }
+
+    void BenchScene::spawnBodies() {
+        if (extra_bodies_ == 0) return;
+
+        // 生成范围：第一个瓦片图层覆盖的区域（没有则使用默认区域），刚体从上半部分落下
+        glm::vec2 area = { 640.0f, 360.0f };
+        for (const auto& obj : game_objects_) {
+            if (auto* layer = obj->getComponent<engine::component::TileLayerComponent>(); layer) {
+                area = glm::vec2(layer->getMapSize() * layer->getTileSize());
+                break;
+            }
+        }
+        std::mt19937 rng(12345);    // 固定种子，保证每次运行的场景相同
+        std::uniform_real_distribution<float> dist_x(0.0f, std::max(area.x - 16.0f, 1.0f));
+        std::uniform_real_distribution<float> dist_y(0.0f, std::max(area.y * 0.5f, 1.0f));
+
+        auto& physics_engine = context_.getPhysicsEngine();
+        for (size_t i = 0; i < extra_bodies_; ++i) {
+            auto body = std::make_unique<engine::object::GameObject>("bench_body");
+            body->addComponent<engine::component::TransformComponent>(glm::vec2(dist_x(rng), dist_y(rng)));
+            body->addComponent<engine::component::SpriteComponent>(BODY_TEXTURE, context_.getResourceManager());
+            body->addComponent<engine::component::ColliderComponent>(std::make_unique<engine::physics::AABBCollider>(glm::vec2(16.0f, 16.0f)));
+            body->addComponent<engine::component::PhysicsComponent>(&physics_engine);
+            addGameObject(std::move(body));
+        }
+        spdlog::info("基准测试：在 {}x{} 区域内生成 {} 个刚体。", area.x, area.y, extra_bodies_);
+    }
+
+} // namespace bench
@@ -0,0 +1,37 @@
+#pragma once
+#include "../engine/scene/scene.h"
+#include <chrono>
+
+namespace bench {
+
+    /// @brief 一帧中各阶段的耗时（毫秒）
+    struct PhaseTimings {
+        double physics_ms = 0.0;        ///< @brief 物理引擎与相机
+        double scene_update_ms = 0.0;   ///< @brief 游戏对象与组件系统
+    };
+
+    /**
+     * @brief 基准测试场景：加载一个关卡（可额外生成 N 个物理刚体），并分别记录物理和对象更新的耗时。
+     */
+    class BenchScene final : public engine::scene::Scene {
+    private:
+        std::string map_path_;              ///< @brief 关卡路径
+        size_t extra_bodies_ = 0;           ///< @brief 额外生成的物理刚体数量
+        PhaseTimings last_timings_;         ///< @brief 最近一次 update 的分阶段耗时
+        bool level_loaded_ = false;         ///< @brief 关卡是否加载成功
+
+    public:
+        BenchScene(std::string map_path, size_t extra_bodies, engine::core::Context& context, engine::scene::SceneManager& scene_manager);
+
+        void init() override;
+        void update(float delta_time) override;
+
+        const PhaseTimings& getLastTimings() const { return last_timings_; }   ///< @brief 获取最近一次 update 的分阶段耗时
+        bool isLevelLoaded() const { return level_loaded_; }                    ///< @brief 关卡是否加载成功
+
+    private:
+        void registerComponentSystems();    ///< @brief 登记引擎组件的系统（与 GameScene 相同的顺序）
+        void spawnBodies();                 ///< @brief 在关卡范围内生成额外的物理刚体（固定随机种子，结果可复现）
+    };
+
+} // namespace bench
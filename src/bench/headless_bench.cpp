@@ -0,0 +1,286 @@
+#include "headless_bench.h"
+#include "bench_scene.h"
+#include "../engine/core/config.h"
+#include "../engine/core/context.h"
+#include "../engine/core/frame_arena.h"
+#include "../engine/core/profiler.h"
+#include "../engine/resource/resource_manager.h"
+#include "../engine/render/renderer.h"
+#include "../engine/render/camera.h"
+#include "../engine/input/input_manager.h"
+#include "../engine/physics/physics_engine.h"
+#include "../engine/scene/scene_manager.h"
+#include <SDL3/SDL.h>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+
+namespace bench {
+
+    namespace {
+        using Clock = std::chrono::steady_clock;
+
+        double elapsedMs(Clock::time_point start) {
+            return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        }
+
+        /// @brief 统计一个阶段所有帧的耗时（毫秒）
+        nlohmann::json summarize(std::vector<double> samples) {
+            if (samples.empty()) return nlohmann::json::object();
+            std::sort(samples.begin(), samples.end());
+            double total = 0.0;
+            for (auto sample : samples) total += sample;
+            auto percentile = [&](double p) {
+                auto index = static_cast<size_t>(p * static_cast<double>(samples.size() - 1) + 0.5);
+                return samples[std::min(index, samples.size() - 1)];
+            };
+            return {
+                { "mean_ms", total / static_cast<double>(samples.size()) },
+                { "min_ms", samples.front() },
+                { "p50_ms", percentile(0.50) },
+                { "p95_ms", percentile(0.95) },
+                { "p99_ms", percentile(0.99) },
+                { "max_ms", samples.back() },
+                { "total_ms", total },
+            };
+        }
+
+        /// @brief 统计一个计数器所有帧的值
+        nlohmann::json summarizeCounter(const std::vector<std::uint64_t>& samples) {
+            if (samples.empty()) return nlohmann::json::object();
+            std::uint64_t total = 0;
+            for (auto sample : samples) total += sample;
+            auto [min_it, max_it] = std::minmax_element(samples.begin(), samples.end());
+            return {
+                { "mean", static_cast<double>(total) / static_cast<double>(samples.size()) },
+                { "min", *min_it },
+                { "max", *max_it },
+                { "total", total },
+            };
+        }
+    } // namespace
+
+    HeadlessBench::HeadlessBench(BenchOptions options) : options_(std::move(options)) {
+    }
+
+    HeadlessBench::~HeadlessBench() {
+        close();
+    }
+
+    bool HeadlessBench::run() {
+        ENGINE_PROFILE_THREAD_NAME("Main");
+        if (!init()) {
+            spdlog::error("基准测试初始化失败。");
+            close();
+            return false;
+        }
+
+        nlohmann::json report;
+        report["config"] = {
+            { "frames", options_.frames },
+            { "warmup_frames", options_.warmup_frames },
+            { "delta_time", options_.delta_time },
+            { "extra_bodies", options_.extra_bodies },
+            { "window", { config_->window_width_, config_->window_height_ } },
+            { "batch_rendering", config_->batch_rendering_ },
+            { "physics_fixed_timestep", config_->physics_fixed_timestep_ },
+            { "video_driver", SDL_GetCurrentVideoDriver() ? SDL_GetCurrentVideoDriver() : "" },
+            { "renderer", SDL_GetRendererName(sdl_renderer_) ? SDL_GetRendererName(sdl_renderer_) : "" },
+        };
+
+        bool all_loaded = true;
+        report["levels"] = nlohmann::json::array();
+        for (const auto& level : options_.levels) {
+            auto level_report = runLevel(level);
+            all_loaded = all_loaded && level_report.value("loaded", false);
+            report["levels"].push_back(std::move(level_report));
+        }
+        close();
+
+        std::ofstream file(options_.output_path);
+        if (!file.is_open()) {
+            spdlog::error("无法写入基准测试报告: {}", options_.output_path);
+            return false;
+        }
+        file << report.dump(2) << '\n';
+        spdlog::info("基准测试报告已写入: {}", options_.output_path);
+        return all_loaded;
+    }
+
+    bool HeadlessBench::init() {
+        try {
+            config_ = std::make_unique<engine::core::Config>(options_.config_path);
+        }
+        catch (const std::exception& e) {
+            spdlog::error("初始化配置失败: {}", e.what());
+            return false;
+        }
+
+        // 默认使用 dummy 视频驱动（环境变量 SDL_VIDEO_DRIVER 优先，例如 offscreen）
+        SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "dummy");
+        if (!SDL_Init(SDL_INIT_VIDEO)) {
+            spdlog::error("SDL 初始化失败! SDL错误: {}", SDL_GetError());
+            return false;
+        }
+        sdl_initialized_ = true;
+        window_ = SDL_CreateWindow(config_->window_title_.c_str(), config_->window_width_, config_->window_height_, SDL_WINDOW_HIDDEN);
+        if (!window_) {
+            spdlog::error("无法创建窗口! SDL错误: {}", SDL_GetError());
+            return false;
+        }
+        sdl_renderer_ = SDL_CreateRenderer(window_, "software");
+        if (!sdl_renderer_) {
+            spdlog::error("无法创建软件渲染器! SDL错误: {}", SDL_GetError());
+            return false;
+        }
+        // 不等待垂直同步；逻辑分辨率与 GameApp 相同
+        SDL_SetRenderVSync(sdl_renderer_, SDL_RENDERER_VSYNC_DISABLED);
+        SDL_SetRenderLogicalPresentation(sdl_renderer_, config_->window_width_ / 2, config_->window_height_ / 2, SDL_LOGICAL_PRESENTATION_LETTERBOX);
+
+        try {
+            resource_manager_ = std::make_unique<engine::resource::ResourceManager>(sdl_renderer_);
+            renderer_ = std::make_unique<engine::render::Renderer>(sdl_renderer_, resource_manager_.get());
+            renderer_->setBatchingEnabled(config_->batch_rendering_);
+            camera_ = std::make_unique<engine::render::Camera>(glm::vec2(config_->window_width_ / 2, config_->window_height_ / 2));
+            input_manager_ = std::make_unique<engine::input::InputManager>(sdl_renderer_, config_.get());
+            physics_engine_ = std::make_unique<engine::physics::PhysicsEngine>();
+            if (config_->physics_fixed_timestep_) {
+                physics_engine_->setFixedTimestep(1.0f / static_cast<float>(config_->physics_update_rate_), config_->physics_max_substeps_);
+            }
+            context_ = std::make_unique<engine::core::Context>(*input_manager_, *renderer_, *camera_, *resource_manager_, *physics_engine_);
+            scene_manager_ = std::make_unique<engine::scene::SceneManager>(*context_);
+        }
+        catch (const std::exception& e) {
+            spdlog::error("初始化引擎子系统失败: {}", e.what());
+            return false;
+        }
+        return true;
+    }
+
+    void HeadlessBench::close() {
+        if (scene_manager_) scene_manager_->close();
+        resource_manager_.reset();
+        if (sdl_renderer_) {
+            SDL_DestroyRenderer(sdl_renderer_);
+            sdl_renderer_ = nullptr;
+        }
+        if (window_) {
+            SDL_DestroyWindow(window_);
+            window_ = nullptr;
+        }
+        if (sdl_initialized_) {
+            SDL_Quit();
+            sdl_initialized_ = false;
+        }
+    }
+
+    nlohmann::json HeadlessBench::runLevel(const std::string& map_path) {
+        nlohmann::json level_report = { { "map", map_path } };
+
+        // 1. 加载（与游戏中同步加载的路径相同）
+        camera_->setPosition(glm::vec2(0.0f));
+        resource_manager_->resetTextureMissCount();
+        auto scene = std::make_unique<BenchScene>(map_path, options_.extra_bodies, *context_, *scene_manager_);
+        ENGINE_PROFILE_FRAME();     // 加载单独算作一帧
+        auto& counters = context_->getFrameCounters();
+        counters.beginFrame();
+        auto load_start = Clock::now();
+        scene->init();
+        level_report["load_ms"] = elapsedMs(load_start);
+        level_report["load_counters"] = nlohmann::json::object();
+        for (const auto& counter : counters.getCounters()) {
+            level_report["load_counters"][counter.name] = counter.value;
+        }
+        level_report["loaded"] = scene->isLevelLoaded();
+        level_report["game_objects"] = scene->getGameObjects().size();
+        level_report["physics_bodies"] = physics_engine_->getBodyCount();
+
+        // 2. 以固定 delta_time 运行，逐帧记录各阶段耗时
+        std::vector<double> input_ms, physics_ms, scene_update_ms, render_ms, present_ms, frame_ms;
+        for (auto* samples : { &input_ms, &physics_ms, &scene_update_ms, &render_ms, &present_ms, &frame_ms }) {
+            samples->reserve(options_.frames);
+        }
+        std::vector<std::vector<std::uint64_t>> counter_samples;    // 下标与 FrameCounters 中的计数器编号一致
+        const float dt = options_.delta_time;
+        for (int frame = 0; frame < options_.warmup_frames + options_.frames; ++frame) {
+            ENGINE_PROFILE_FRAME();
+            ENGINE_PROFILE_SCOPE("HeadlessBench::frame");
+            auto frame_start = Clock::now();
+            context_->getFrameArena().reset();
+            counters.beginFrame();
+
+            auto start = Clock::now();
+            input_manager_->update();
+            scene->handleInput();
+            double input = elapsedMs(start);
+
+            scene->update(dt);
+
+            start = Clock::now();
+            renderer_->clearScreen();
+            scene->render();
+            renderer_->flush();     // 批处理模式下绘制在 flush 时才真正提交，计入渲染而不是 present
+            double render = elapsedMs(start);
+
+            start = Clock::now();
+            renderer_->present();
+            double present = elapsedMs(start);
+
+            if (frame < options_.warmup_frames) continue;
+            const auto& timings = scene->getLastTimings();
+            input_ms.push_back(input);
+            physics_ms.push_back(timings.physics_ms);
+            scene_update_ms.push_back(timings.scene_update_ms);
+            render_ms.push_back(render);
+            present_ms.push_back(present);
+            frame_ms.push_back(elapsedMs(frame_start));
+            // 计数器可能在运行中才注册（例如第一次用到时），对应的早期帧视为0
+            counter_samples.resize(counters.getCounters().size());
+            for (size_t id = 0; id < counter_samples.size(); ++id) {
+                counter_samples[id].resize(frame_ms.size() - 1, 0);
+                counter_samples[id].push_back(counters.getValue(static_cast<engine::core::CounterId>(id)));
+            }
+        }
+
+        level_report["phases"] = {
+            { "input", summarize(std::move(input_ms)) },
+            { "physics", summarize(std::move(physics_ms)) },
+            { "scene_update", summarize(std::move(scene_update_ms)) },
+            { "render", summarize(std::move(render_ms)) },
+            { "present", summarize(std::move(present_ms)) },
+            { "frame", summarize(frame_ms) },
+        };
+        level_report["counters"] = nlohmann::json::object();
+        for (size_t id = 0; id < counter_samples.size(); ++id) {
+            level_report["counters"][counters.getCounters()[id].name] = summarizeCounter(counter_samples[id]);
+        }
+        level_report["awake_bodies"] = physics_engine_->getAwakeBodyCount();
+        level_report["sleeping_bodies"] = physics_engine_->getSleepingBodyCount();
+        level_report["draw_calls_last_frame"] = renderer_->getLastFlushDrawCalls();
+        level_report["texture_misses"] = resource_manager_->getTextureMissCount();
+
+        double mean_frame = level_report["phases"]["frame"].value("mean_ms", 0.0);
+        spdlog::info("关卡 '{}': 加载 {:.1f} ms，平均每帧 {:.3f} ms（{} 帧）", map_path,
+                     level_report["load_ms"].get<double>(), mean_frame, options_.frames);
+
+        // 3. 导出本关卡（加载及所有帧）的性能分析数据，环形缓冲区写满时只保留最近的记录
+        if (!options_.trace_path.empty()) {
+            auto trace_path = std::filesystem::path(options_.trace_path);
+            if (options_.levels.size() > 1) {
+                trace_path.replace_filename(trace_path.stem().string() + "_" + std::filesystem::path(map_path).stem().string() +
+                                            trace_path.extension().string());
+            }
+            engine::core::Profiler::get().writeChromeTrace(trace_path.string(), options_.warmup_frames + options_.frames + 1);
+        }
+
+        // 4. 清理，下一个关卡重新加载纹理
+        scene->clean();
+        scene.reset();
+        resource_manager_->clearTextures();
+        return level_report;
+    }
+
+} // namespace bench
@@ -0,0 +1,90 @@
+#pragma once
+#include <memory>
+#include <string>
+#include <vector>
+#include <nlohmann/json_fwd.hpp>
+
+struct SDL_Window;
+struct SDL_Renderer;
+
+namespace engine::core {
+    class Config;
+    class Context;
+}
+namespace engine::resource {
+    class ResourceManager;
+}
+namespace engine::render {
+    class Renderer;
+    class Camera;
+}
+namespace engine::input {
+    class InputManager;
+}
+namespace engine::physics {
+    class PhysicsEngine;
+}
+namespace engine::scene {
+    class SceneManager;
+}
+
+namespace bench {
+
+    /// @brief 基准测试参数（由命令行解析得到）
+    struct BenchOptions {
+        std::vector<std::string> levels;                    ///< @brief 要测试的关卡路径
+        int frames = 600;                                   ///< @brief 每个关卡记录的帧数
+        int warmup_frames = 30;                             ///< @brief 记录前先运行的帧数（不计入结果）
+        float delta_time = 1.0f / 60.0f;                    ///< @brief 每帧固定的 delta_time（秒）
+        size_t extra_bodies = 0;                            ///< @brief 每个关卡额外生成的物理刚体数量
+        std::string config_path = "assets/config.json";     ///< @brief 配置文件（窗口尺寸、物理步长等）
+        std::string output_path = "bench_report.json";      ///< @brief JSON 报告输出路径
+        std::string trace_path;                             ///< @brief 非空时，每个关卡结束后把性能分析数据导出为 Chrome trace（多个关卡时文件名追加关卡名）
+    };
+
+    /**
+     * @brief 无窗口的基准测试程序：以 SDL 的 dummy 视频驱动（可通过环境变量 SDL_VIDEO_DRIVER 改为 offscreen）
+     * 和软件渲染器启动与 GameApp 相同的引擎子系统，依次加载关卡并以固定 delta_time 运行固定帧数，
+     * 输出各阶段（输入、物理、场景更新、渲染、提交）耗时的 JSON 报告。
+     */
+    class HeadlessBench final {
+    private:
+        BenchOptions options_;
+        SDL_Window* window_ = nullptr;
+        SDL_Renderer* sdl_renderer_ = nullptr;
+        bool sdl_initialized_ = false;
+
+        // 引擎组件（声明顺序与 GameApp 相同）
+        std::unique_ptr<engine::core::Config> config_;
+        std::unique_ptr<engine::resource::ResourceManager> resource_manager_;
+        std::unique_ptr<engine::render::Renderer> renderer_;
+        std::unique_ptr<engine::render::Camera> camera_;
+        std::unique_ptr<engine::input::InputManager> input_manager_;
+        std::unique_ptr<engine::core::Context> context_;
+        std::unique_ptr<engine::scene::SceneManager> scene_manager_;
+        std::unique_ptr<engine::physics::PhysicsEngine> physics_engine_;
+
+    public:
+        explicit HeadlessBench(BenchOptions options);
+        ~HeadlessBench();
+
+        // 禁止拷贝和移动
+        HeadlessBench(const HeadlessBench&) = delete;
+        HeadlessBench& operator=(const HeadlessBench&) = delete;
+        HeadlessBench(HeadlessBench&&) = delete;
+        HeadlessBench& operator=(HeadlessBench&&) = delete;
+
+        /**
+         * @brief 初始化子系统，运行所有关卡并写出报告。
+         * @return 全部关卡加载成功且报告写出成功时返回 true
+         */
+        [[nodiscard]] bool run();
+
+    private:
+        [[nodiscard]] bool init();
+        void close();
+        /// @brief 运行一个关卡，返回该关卡的报告（加载失败时 "loaded" 为 false）
+        nlohmann::json runLevel(const std::string& map_path);
+    };
+
+} // namespace bench
@@ -2,6 +2,7 @@
 #include "sprite_component.h"
 #include "../object/game_object.h"
 #include "../render/animation.h"
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::component {
@@ -23,7 +24,7 @@ namespace engine::component {
     void AnimationComponent::update(float delta_time, engine::core::Context&) {
         // 如果没有正在播放的动画，或者没有当前动画，或者没有精灵组件，或者当前动画没有帧，则直接返回
         if (!is_playing_ || !current_animation_ || !sprite_component_ || current_animation_->isEmpty()) {
-            spdlog::trace("AnimationComponent 更新时没有正在播放的动画或精灵组件为空。");
+            ENGINE_LOG_TRACE("AnimationComponent 更新时没有正在播放的动画或精灵组件为空。");
             return;
         }
 
@@ -46,11 +47,20 @@ namespace engine::component {
         }
     }
 
+    void AnimationComponent::onAcquire() {
+        if (!current_animation_) return;
+        animation_timer_ = 0.0f;
+        is_playing_ = true;
+        if (sprite_component_ && !current_animation_->isEmpty()) {
+            sprite_component_->setSourceRect(current_animation_->getFrame(0.0f).source_rect);
+        }
+    }
+
     void AnimationComponent::addAnimation(std::unique_ptr<engine::render::Animation> animation) {
         if (!animation) return;
         std::string name = animation->getName();    // 获取名称
         animations_[name] = std::move(animation);
-        spdlog::debug("已将动画 '{}' 添加到 GameObject '{}'", name, owner_ ? owner_->getName() : "未知");
+        ENGINE_LOG_DEBUG("已将动画 '{}' 添加到 GameObject '{}'", name, owner_ ? owner_->getName() : "未知");
     }
 
     void AnimationComponent::playAnimation(const std::string& name) {
@@ -73,7 +83,7 @@ namespace engine::component {
         if (sprite_component_ && !current_animation_->isEmpty()) {
             const auto& first_frame = current_animation_->getFrame(0.0f);
             sprite_component_->setSourceRect(first_frame.source_rect);
-            spdlog::debug("GameObject '{}' 播放动画 '{}'", owner_ ? owner_->getName() : "未知", name);
+            ENGINE_LOG_DEBUG("GameObject '{}' 播放动画 '{}'", owner_ ? owner_->getName() : "未知", name);
         }
     }
 
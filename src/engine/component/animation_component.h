@@ -56,6 +56,8 @@ namespace engine::component {
         // 核心循环方法
         void init() override;
         void update(float, engine::core::Context&) override;
+        void onRelease() override { is_playing_ = false; }     ///< @brief 回收到对象池：停止播放
+        void onAcquire() override;                              ///< @brief 从对象池取出：从头重新播放当前动画
     };
 
 } // namespace engine::component
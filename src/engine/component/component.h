@@ -1,7 +1,10 @@
 #pragma once
+#include <cstddef>
+
 // 前置声明
 namespace engine::object {
     class GameObject;
+    class ComponentRegistry;
 }
 
 namespace engine::core {
@@ -18,6 +21,10 @@ namespace engine::component {
      */
     class Component {
         friend class engine::object::GameObject;        // 它需要调用Component的init方法
+        friend class engine::object::ComponentRegistry; // 它按组件类型集中调用 handleInput / update
+
+    private:
+        std::size_t registry_slot_ = static_cast<std::size_t>(-1);   ///< @brief 在 ComponentRegistry 类型数组中的下标（由注册表维护）
 
     protected:
         engine::object::GameObject* owner_ = nullptr;   ///< @brief 指向拥有此组件的 GameObject
@@ -42,6 +49,9 @@ namespace engine::component {
         virtual void update(float, engine::core::Context&) = 0;             ///< @brief 更新，必须实现
         virtual void render(engine::core::Context&) {}                      ///< @brief 渲染
         virtual void clean() {}                                             ///< @brief 清理
+        virtual void onComponentsChanged() {}                               ///< @brief 所属 GameObject 增删组件后调用，用于刷新缓存的组件指针
+        virtual void onRelease() {}                                         ///< @brief 所属 GameObject 被回收到对象池时调用：注销外部登记、停止行为（组件本身保留）
+        virtual void onAcquire() {}                                         ///< @brief 所属 GameObject 从对象池取出时调用：恢复初始状态并重新登记
     };
 
 } // namespace engine::component
\ No newline at end of file
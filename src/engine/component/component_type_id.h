@@ -0,0 +1,33 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace engine::component {
+
+    using ComponentTypeId = std::uint32_t;      ///< @brief 组件类型的紧凑编号，从0开始连续分配
+
+    /// @brief 组件类型数量上限（GameObject 用定长数组按类型编号索引组件）
+    inline constexpr std::size_t MAX_COMPONENT_TYPES = 32;
+
+    namespace detail {
+        /// @brief 分配下一个组件类型编号（全程序共享一个计数器）
+        inline ComponentTypeId nextComponentTypeId() {
+            static std::atomic<ComponentTypeId> counter{ 0 };
+            return counter.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief 获取组件类型 T 的编号。
+     *
+     * 每个类型在第一次调用时从计数器取得编号，之后直接返回静态变量，代替 std::type_index 的哈希查找。
+     * @note 编号只在本次运行中有效（取决于首次使用的顺序），不要序列化。
+     */
+    template <typename T>
+    ComponentTypeId getComponentTypeId() {
+        static const ComponentTypeId id = detail::nextComponentTypeId();
+        return id;
+    }
+
+} // namespace engine::component
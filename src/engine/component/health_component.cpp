@@ -1,5 +1,6 @@
 #include "health_component.h"
 #include "../../engine/object/game_object.h"
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 #include <glm/common.hpp>
 
@@ -29,7 +30,7 @@ namespace engine::component {
         }
 
         if (is_invincible_) {
-            spdlog::debug("游戏对象 '{}' 处于无敌状态，免疫了 {} 点伤害。", owner_ ? owner_->getName() : "Unknown", damage_amount);
+            ENGINE_LOG_DEBUG("游戏对象 '{}' 处于无敌状态，免疫了 {} 点伤害。", owner_ ? owner_->getName() : "Unknown", damage_amount);
             return false; // 无敌状态，不受伤
         }
         // --- 确实造成伤害了 ---
@@ -39,7 +40,7 @@ namespace engine::component {
         if (isAlive() && invincibility_duration_ > 0.0f) {
             setInvincible(invincibility_duration_);
         }
-        spdlog::debug("游戏对象 '{}' 受到了 {} 点伤害，当前生命值: {}/{}。",
+        ENGINE_LOG_DEBUG("游戏对象 '{}' 受到了 {} 点伤害，当前生命值: {}/{}。",
             owner_ ? owner_->getName() : "Unknown", damage_amount, current_health_, max_health_);
         return true;        // 造成伤害，返回true
     }
@@ -51,7 +52,7 @@ namespace engine::component {
 
         current_health_ += heal_amount;
         current_health_ = std::min(max_health_, current_health_); // 防止超过最大生命值
-        spdlog::debug("游戏对象 '{}' 治疗了 {} 点，当前生命值: {}/{}。",
+        ENGINE_LOG_DEBUG("游戏对象 '{}' 治疗了 {} 点，当前生命值: {}/{}。",
             owner_ ? owner_->getName() : "Unknown", heal_amount, current_health_, max_health_);
     }
 
@@ -61,13 +62,13 @@ namespace engine::component {
         {
             is_invincible_ = true;
             invincibility_timer_ = duration;
-            spdlog::debug("游戏对象 '{}' 进入无敌状态，持续 {} 秒。", owner_ ? owner_->getName() : "Unknown", duration);
+            ENGINE_LOG_DEBUG("游戏对象 '{}' 进入无敌状态，持续 {} 秒。", owner_ ? owner_->getName() : "Unknown", duration);
         }
         else {
             // 如果持续时间为 0 或负数，则立即取消无敌
             is_invincible_ = false;
             invincibility_timer_ = 0.0f;
-            spdlog::debug("游戏对象 '{}' 的无敌状态被手动移除。", owner_ ? owner_->getName() : "Unknown");
+            ENGINE_LOG_DEBUG("游戏对象 '{}' 的无敌状态被手动移除。", owner_ ? owner_->getName() : "Unknown");
         }
     }
 
@@ -83,4 +84,11 @@ namespace engine::component {
         current_health_ = glm::max(0, glm::min(current_health, max_health_));
     }
 
+    void HealthComponent::onAcquire()
+    {
+        current_health_ = max_health_;
+        is_invincible_ = false;
+        invincibility_timer_ = 0.0f;
+    }
+
 } // namespace engine::component
\ No newline at end of file
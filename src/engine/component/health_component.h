@@ -54,6 +54,7 @@ namespace engine::component {
     protected:
         // 核心循环函数
         void update(float, engine::core::Context&) override;
+        void onAcquire() override;              ///< @brief 从对象池取出：恢复满生命值并取消无敌
     };
 
 } // namespace engine::component
\ No newline at end of file
@@ -5,16 +5,18 @@
 #include "../render/sprite.h"
 #include "../object/game_object.h"
 #include "../core/context.h"
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::component {
 
-    ParallaxComponent::ParallaxComponent(const std::string& texture_id, const glm::vec2& scroll_factor, const glm::bvec2& repeat)
-        : sprite_(engine::render::Sprite(texture_id)),          // 视差背景默认为整张图片
+    ParallaxComponent::ParallaxComponent(const std::string& texture_id, engine::resource::ResourceManager& resource_manager,
+                                         const glm::vec2& scroll_factor, const glm::bvec2& repeat)
+        : sprite_(engine::render::Sprite(resource_manager, texture_id)),  // 视差背景默认为整张图片
         scroll_factor_(scroll_factor),
         repeat_(repeat)
     {
-        spdlog::trace("ParallaxComponent 初始化完成，纹理 ID: {}", texture_id);
+        ENGINE_LOG_TRACE("ParallaxComponent 初始化完成，纹理 ID: {}", texture_id);
     }
 
     void ParallaxComponent::init() {
@@ -4,6 +4,10 @@
 #include <string>
 #include <glm/vec2.hpp>
 
+namespace engine::resource {
+    class ResourceManager;
+}
+
 namespace engine::component {
     class TransformComponent;
 
@@ -26,12 +30,14 @@ namespace engine::component {
         /**
          * @brief 构造函数
          * @param texture_id 背景纹理的资源 ID。
+         * @param resource_manager 资源管理器（用于将纹理 ID 换成句柄）。
          * @param scroll_factor 控制背景相对于相机移动速度的因子。
          *                      (0, 0) 表示完全静止。
          *                      (1, 1) 表示与相机完全同步移动。
          *                      (0.5, 0.5) 表示以相机一半的速度移动。
          */
-        ParallaxComponent(const std::string& texture_id, const glm::vec2& scroll_factor, const glm::bvec2& repeat);
+        ParallaxComponent(const std::string& texture_id, engine::resource::ResourceManager& resource_manager,
+                          const glm::vec2& scroll_factor, const glm::bvec2& repeat);
 
         // --- 设置器 ---
         void setSprite(const engine::render::Sprite& sprite) { sprite_ = sprite; }  ///< @brief 设置精灵对象
@@ -2,6 +2,7 @@
 #include "transform_component.h"
 #include "../object/game_object.h"
 #include "../physics/physics_engine.h"
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::component {
@@ -11,7 +12,7 @@ namespace engine::component {
         if (!physics_engine_) {
             spdlog::error("PhysicsComponent构造函数中，PhysicsEngine指针不能为nullptr！");
         }
-        spdlog::trace("物理组件创建完成，质量: {}, 使用重力: {}", mass_, use_gravity_);
+        ENGINE_LOG_TRACE("物理组件创建完成，质量: {}, 使用重力: {}", mass_, use_gravity_);
     }
 
     void PhysicsComponent::init() {
@@ -29,13 +30,85 @@ namespace engine::component {
         }
         // 注册到PhysicsEngine
         physics_engine_->registerComponent(this);
-        spdlog::trace("物理组件初始化完成。");
+        ENGINE_LOG_TRACE("物理组件初始化完成。");
     }
 
     void PhysicsComponent::clean()
     {
         physics_engine_->unregisterComponent(this);
-        spdlog::trace("物理组件清理完成。");
+        ENGINE_LOG_TRACE("物理组件清理完成。");
+    }
+
+    void PhysicsComponent::addForce(const glm::vec2& force)
+    {
+        if (!enabled_ || !isRegistered()) return;
+        if (force.x != 0.0f || force.y != 0.0f) wakeUp();
+        body_storage_->addForce(body_index_, force);
+    }
+
+    void PhysicsComponent::setVelocity(const glm::vec2& velocity)
+    {
+        if (!isRegistered()) return;
+        if (sleeping_ && velocity != body_storage_->getVelocity(body_index_)) wakeUp();
+        body_storage_->setVelocity(body_index_, velocity);
+    }
+
+    void PhysicsComponent::wakeUp()
+    {
+        resting_frames_ = 0;
+        if (!sleeping_) return;
+        sleeping_ = false;
+        if (isRegistered()) body_storage_->setFlag(body_index_, engine::physics::BodyStorage::FLAG_SLEEPING, false);
+        ENGINE_LOG_TRACE("物理组件被唤醒。");
+    }
+
+    void PhysicsComponent::sleep()
+    {
+        if (sleeping_ || !isRegistered()) return;
+        sleeping_ = true;
+        body_storage_->setVelocity(body_index_, { 0.0f, 0.0f });
+        body_storage_->clearForce(body_index_);
+        body_storage_->setFlag(body_index_, engine::physics::BodyStorage::FLAG_SLEEPING, true);
+        ENGINE_LOG_TRACE("物理组件进入休眠。");
+    }
+
+    void PhysicsComponent::setEnabled(bool enabled)
+    {
+        wakeUp();
+        enabled_ = enabled;
+        if (isRegistered()) body_storage_->setFlag(body_index_, engine::physics::BodyStorage::FLAG_ENABLED, enabled);
+    }
+
+    void PhysicsComponent::setMass(float mass)
+    {
+        wakeUp();
+        mass_ = (mass >= 0.0f) ? mass : 1.0f;
+        if (isRegistered()) body_storage_->setMass(body_index_, mass_);
+    }
+
+    void PhysicsComponent::setUseGravity(bool use_gravity)
+    {
+        wakeUp();
+        use_gravity_ = use_gravity;
+        if (isRegistered()) body_storage_->setFlag(body_index_, engine::physics::BodyStorage::FLAG_GRAVITY, use_gravity);
+    }
+
+    void PhysicsComponent::onComponentsChanged()
+    {
+        if (!owner_ || !physics_engine_) return;
+        transform_ = owner_->getComponent<TransformComponent>();
+        physics_engine_->refreshComponent(this);
+    }
+
+    void PhysicsComponent::onRelease()
+    {
+        if (physics_engine_) physics_engine_->unregisterComponent(this);
+    }
+
+    void PhysicsComponent::onAcquire()
+    {
+        resetCollisionFlags();
+        if (physics_engine_ && !isRegistered()) physics_engine_->registerComponent(this);
     }
 
 } // namespace engine::component
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #include "component.h"
+#include "../physics/body_storage.h"
 #include "glm/vec2.hpp"
 
 namespace engine::physics {
@@ -12,22 +13,26 @@ namespace engine::component {
     /**
      * @brief 管理GameObject的物理属性
      *
-     * 存储速度、质量、力和重力设置。与PhysicsEngine交互。
+     * 保存质量和重力设置；速度和力存放在 PhysicsEngine 的 BodyStorage 中（SoA 布局，便于批量积分），
+     * 本组件只持有其下标，通过访问器读写。未注册到物理引擎时，速度读取为0，写入被忽略。
      */
     class PhysicsComponent final : public Component {
         friend class engine::object::GameObject;
-    public:
-        glm::vec2 velocity_ = { 0.0f, 0.0f };             ///< @brief 物体的速度，设为公共成员变量，方便PhysicsEngine访问更新
-
+        friend class engine::physics::PhysicsEngine;
     private:
         engine::physics::PhysicsEngine* physics_engine_ = nullptr;  ///< @brief 指向PhysicsEngine的指针
         TransformComponent* transform_ = nullptr;                   ///< @brief TransformComponent的缓存指针
+        engine::physics::BodyStorage* body_storage_ = nullptr;      ///< @brief 刚体数据存储（注册后由 PhysicsEngine 设置）
+        std::size_t body_index_ = engine::physics::BodyStorage::INVALID_INDEX;  ///< @brief 在 BodyStorage 中的下标
 
-        glm::vec2 force_ = { 0.0f, 0.0f };                            ///< @brief 当前帧受到的力
         float mass_ = 1.0f;                             ///< @brief 物体质量（默认1.0）
         bool use_gravity_ = true;                       ///< @brief 物体是否受重力影响
         bool enabled_ = true;                           ///< @brief 组件是否激活
 
+        // --- 休眠状态 (由 PhysicsEngine 管理) ---
+        bool sleeping_ = false;                         ///< @brief 是否处于休眠（跳过积分和瓦片碰撞处理）
+        int resting_frames_ = 0;                        ///< @brief 连续"着地且几乎静止"的帧数
+
         // --- 碰撞状态标志 ---
         bool collided_below_ = false;
         bool collided_above_ = false;
@@ -52,19 +57,24 @@ namespace engine::component {
         PhysicsComponent& operator=(PhysicsComponent&&) = delete;
 
         // PhysicsEngine使用的物理方法
-        void addForce(const glm::vec2& force) { if (enabled_) force_ += force; }    ///< @brief 添加力
-        void clearForce() { force_ = { 0.0f, 0.0f }; }                                ///< @brief 清除力
-        const glm::vec2& getForce() const { return force_; }                        ///< @brief 获取当前力
+        void addForce(const glm::vec2& force);                                      ///< @brief 添加力（非零的力会唤醒休眠的刚体）
+        void clearForce() { if (isRegistered()) body_storage_->clearForce(body_index_); }                                      ///< @brief 清除力
+        glm::vec2 getForce() const { return isRegistered() ? body_storage_->getForce(body_index_) : glm::vec2(0.0f); }         ///< @brief 获取当前力
         float getMass() const { return mass_; }                                     ///< @brief 获取质量
         bool isEnabled() const { return enabled_; }                                 ///< @brief 获取组件是否启用
         bool isUseGravity() const { return use_gravity_; }                          ///< @brief 获取组件是否受重力影响
 
         // 设置器/获取器
-        void setEnabled(bool enabled) { enabled_ = enabled; }                       ///< @brief 设置组件是否启用
-        void setMass(float mass) { mass_ = (mass >= 0.0f) ? mass : 1.0f; }          ///< @brief 设置质量，质量不能为负
-        void setUseGravity(bool use_gravity) { use_gravity_ = use_gravity; }        ///< @brief 设置组件是否受重力影响
-        void setVelocity(const glm::vec2& velocity) { velocity_ = velocity; }       ///< @brief 设置速度
-        const glm::vec2& getVelocity() const { return velocity_; }                  ///< @brief 获取当前速度
+        void setEnabled(bool enabled);                                              ///< @brief 设置组件是否启用
+        void setMass(float mass);                                                   ///< @brief 设置质量，质量不能为负
+        void setUseGravity(bool use_gravity);                                       ///< @brief 设置组件是否受重力影响
+        void setVelocity(const glm::vec2& velocity);                                ///< @brief 设置速度（速度改变时唤醒休眠的刚体）
+        void setVelocityX(float vx) { setVelocity({ vx, getVelocity().y }); }       ///< @brief 只设置x方向速度
+        void setVelocityY(float vy) { setVelocity({ getVelocity().x, vy }); }       ///< @brief 只设置y方向速度
+        glm::vec2 getVelocity() const { return isRegistered() ? body_storage_->getVelocity(body_index_) : glm::vec2(0.0f); }   ///< @brief 获取当前速度
+        bool isRegistered() const { return body_storage_ != nullptr; }             ///< @brief 是否已注册到物理引擎
+        bool isSleeping() const { return sleeping_; }                               ///< @brief 是否处于休眠状态
+        void wakeUp();                                                              ///< @brief 唤醒刚体（例如直接修改了位置之后）
         TransformComponent* getTransform() const { return transform_; }             ///< @brief 获取TransformComponent指针
 
         // --- 碰撞状态访问与修改 (供 PhysicsEngine 使用) ---
@@ -87,10 +97,15 @@ namespace engine::component {
         bool hasCollidedRight() const { return collided_right_; }       ///< @brief 检查是否与右方发生碰撞
 
     private:
+        void sleep();                           ///< @brief 进入休眠状态，速度归零 (由 PhysicsEngine 调用)
+
         // 核心循环方法
         void init() override;
         void update(float, engine::core::Context&) override {}
         void clean() override;
+        void onComponentsChanged() override;    ///< @brief 同一 GameObject 组件增删后，刷新缓存指针及物理引擎中的刚体记录
+        void onRelease() override;              ///< @brief 回收到对象池：从物理引擎注销
+        void onAcquire() override;              ///< @brief 从对象池取出：重新注册（速度和力归零）并清除碰撞标志
     };
 
 } // namespace engine::component
\ No newline at end of file
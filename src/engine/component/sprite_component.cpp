@@ -5,7 +5,9 @@
 #include "../render/renderer.h"
 #include "../resource/resource_manager.h"
 #include "../render/camera.h"
+#include "../physics/physics_engine.h"
 #include <stdexcept>          // 用于 std::runtime_error
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::component {
@@ -16,7 +18,7 @@ namespace engine::component {
         engine::utils::Alignment alignment,
         std::optional<SDL_FRect> source_rect_opt,
         bool is_flipped
-    ) : resource_manager_(&resource_manager), sprite_(texture_id, source_rect_opt, is_flipped),
+    ) : resource_manager_(&resource_manager), sprite_(resource_manager, texture_id, source_rect_opt, is_flipped),
         alignment_(alignment)
     {
         if (!resource_manager_) {
@@ -24,7 +26,7 @@ namespace engine::component {
             // 不要在游戏主循环中使用 try...catch / throw，会极大影响性能
         }
         // offset_ 和 sprite_size_ 将在 init 中计算
-        spdlog::trace("创建 SpriteComponent，纹理ID: {}", texture_id);
+        ENGINE_LOG_TRACE("创建 SpriteComponent，纹理ID: {}", texture_id);
     }
 
     SpriteComponent::SpriteComponent(engine::render::Sprite&& sprite, engine::resource::ResourceManager& resource_manager, engine::utils::Alignment alignment)
@@ -35,7 +37,7 @@ namespace engine::component {
             // 不要在游戏主循环中使用 try...catch / throw，会极大影响性能
         }
         // offset_ 和 sprite_size_ 将在 init 中计算
-        spdlog::trace("创建 SpriteComponent，纹理ID: {}", sprite_.getTextureId());
+        ENGINE_LOG_TRACE("创建 SpriteComponent，纹理ID: {}", getTextureId());
     }
 
     void SpriteComponent::init() {
@@ -91,8 +93,8 @@ namespace engine::component {
             return;
         }
 
-        // 获取变换信息（考虑偏移量）
-        const glm::vec2& pos = transform_->getPosition() + offset_;
+        // 获取变换信息（考虑偏移量，位置使用固定步长物理的插值结果）
+        const glm::vec2& pos = transform_->getInterpolatedPosition(context.getPhysicsEngine().getInterpolationAlpha()) + offset_;
         const glm::vec2& scale = transform_->getScale();
         float rotation_degrees = transform_->getRotation();
 
@@ -100,8 +102,12 @@ namespace engine::component {
         context.getRenderer().drawSprite(context.getCamera(), sprite_, pos, scale, rotation_degrees);
     }
 
+    const std::string& SpriteComponent::getTextureId() const {
+        return resource_manager_->getTexturePath(sprite_.getTextureHandle());
+    }
+
     void SpriteComponent::setSpriteById(const std::string& texture_id, const std::optional<SDL_FRect>& source_rect_opt) {
-        sprite_.setTextureId(texture_id);
+        sprite_.setTextureHandle(resource_manager_->getTextureHandle(texture_id));
         sprite_.setSourceRect(source_rect_opt);
 
         updateSpriteSize();
@@ -124,7 +130,7 @@ namespace engine::component {
             sprite_size_ = { src_rect.w, src_rect.h };
         }
         else {
-            sprite_size_ = resource_manager_->getTextureSize(sprite_.getTextureId());
+            sprite_size_ = resource_manager_->getTextureSize(sprite_.getTextureHandle());
         }
     }
 
@@ -76,7 +76,7 @@ namespace engine::component {
 
         // Getters
         const engine::render::Sprite& getSprite() const { return sprite_; }         ///< @brief 获取精灵对象
-        const std::string& getTextureId() const { return sprite_.getTextureId(); }  ///< @brief 获取纹理ID
+        const std::string& getTextureId() const;                                    ///< @brief 获取纹理ID（通过句柄查询文件路径）
         bool isFlipped() const { return sprite_.isFlipped(); }                      ///< @brief 获取是否翻转
         bool isHidden() const { return is_hidden_; }                                ///< @brief 获取是否隐藏
         const glm::vec2& getSpriteSize() const { return sprite_size_; }             ///< @brief 获取精灵尺寸
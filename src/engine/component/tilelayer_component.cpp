@@ -1,9 +1,12 @@
 #include "tilelayer_component.h"
 #include "../object/game_object.h"
 #include "../core/context.h"
+#include "../core/profiler.h"
 #include "../render/renderer.h"
 #include "../render/camera.h"
 #include "../physics/physics_engine.h"
+#include <SDL3/SDL.h>
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::component {
@@ -18,45 +21,224 @@ namespace engine::component {
             tiles_.clear();
             map_size_ = { 0, 0 };
         }
-        spdlog::trace("TileLayerComponent 构造完成");
+        // 生成紧凑的类型网格 (1字节/瓦片)，物理查询时不必访问包含 Sprite 的 TileInfo
+        tile_types_.reserve(tiles_.size());
+        for (const auto& tile : tiles_) {
+            tile_types_.push_back(static_cast<std::uint8_t>(tile.type));
+        }
+        buildChunks();
+        ENGINE_LOG_TRACE("TileLayerComponent 构造完成");
     }
 
     void TileLayerComponent::init() {
         if (!owner_) {
             spdlog::warn("TileLayerComponent 的 owner_ 未设置。");
         }
-        spdlog::trace("TileLayerComponent 初始化完成");
+        ENGINE_LOG_TRACE("TileLayerComponent 初始化完成");
+    }
+
+    void TileLayerComponent::SDLTextureDeleter::operator()(SDL_Texture* texture) const
+    {
+        if (texture) {
+            SDL_DestroyTexture(texture);
+        }
+    }
+
+    void TileLayerComponent::buildChunks()
+    {
+        chunks_.clear();
+        overhang_ = { 0, 0 };
+        if (map_size_.x <= 0 || map_size_.y <= 0 || tile_size_.x <= 0 || tile_size_.y <= 0) {
+            chunk_count_ = { 0, 0 };
+            return;
+        }
+        chunk_count_ = { (map_size_.x + CHUNK_SIZE - 1) / CHUNK_SIZE, (map_size_.y + CHUNK_SIZE - 1) / CHUNK_SIZE };
+        chunks_.resize(static_cast<size_t>(chunk_count_.x) * chunk_count_.y);
+
+        // 记录图片大于瓦片时超出的列数/行数 (瓦片层以左下角对齐，图片向右、向上超出)
+        for (const auto& tile_info : tiles_) {
+            if (tile_info.type == TileType::EMPTY) continue;
+            if (const auto& src_rect = tile_info.sprite.getSourceRect(); src_rect) {
+                auto cols = static_cast<int>(std::ceil((src_rect->w - tile_size_.x) / tile_size_.x));
+                auto rows = static_cast<int>(std::ceil((src_rect->h - tile_size_.y) / tile_size_.y));
+                overhang_.x = std::max(overhang_.x, cols);
+                overhang_.y = std::max(overhang_.y, rows);
+            }
+        }
+        for (int chunk_y = 0; chunk_y < chunk_count_.y; ++chunk_y) {
+            for (int chunk_x = 0; chunk_x < chunk_count_.x; ++chunk_x) {
+                rebuildChunk(chunk_x, chunk_y);
+            }
+        }
+        ENGINE_LOG_TRACE("TileLayerComponent 分块完成：{}x{} 个块", chunk_count_.x, chunk_count_.y);
+    }
+
+    void TileLayerComponent::rebuildChunk(int chunk_x, int chunk_y)
+    {
+        auto& chunk = chunks_[static_cast<size_t>(chunk_y) * chunk_count_.x + chunk_x];
+        chunk.tiles.clear();
+        chunk.dirty = true;
+        // 块内的索引保持行主序（与原先的绘制顺序一致）
+        auto end_x = std::min((chunk_x + 1) * CHUNK_SIZE, map_size_.x);
+        auto end_y = std::min((chunk_y + 1) * CHUNK_SIZE, map_size_.y);
+        for (int y = chunk_y * CHUNK_SIZE; y < end_y; ++y) {
+            for (int x = chunk_x * CHUNK_SIZE; x < end_x; ++x) {
+                auto index = static_cast<size_t>(y) * map_size_.x + x;
+                if (tiles_[index].type != TileType::EMPTY) {
+                    chunk.tiles.push_back(static_cast<std::uint32_t>(index));
+                }
+            }
+        }
+    }
+
+    glm::vec2 TileLayerComponent::getTileDrawPosition(int x, int y) const
+    {
+        const auto& tile_info = tiles_[static_cast<size_t>(y) * map_size_.x + x];
+        // 计算该瓦片在世界中的左上角位置 (drawSprite 预期接收左上角坐标)
+        glm::vec2 tile_left_top_pos = {
+            offset_.x + static_cast<float>(x) * tile_size_.x,
+            offset_.y + static_cast<float>(y) * tile_size_.y
+        };
+        // 但如果图片的大小与瓦片的大小不一致，需要调整 y 坐标 (瓦片层的对齐点是左下角)
+        if (static_cast<int>(tile_info.sprite.getSourceRect()->h) != tile_size_.y) {
+            tile_left_top_pos.y -= (tile_info.sprite.getSourceRect()->h - static_cast<float>(tile_size_.y));
+        }
+        return tile_left_top_pos;
+    }
+
+    glm::vec2 TileLayerComponent::getChunkTextureOrigin(int chunk_x, int chunk_y) const
+    {
+        return {
+            offset_.x + static_cast<float>(chunk_x * CHUNK_SIZE * tile_size_.x),
+            offset_.y + static_cast<float>((chunk_y * CHUNK_SIZE - overhang_.y) * tile_size_.y)
+        };
+    }
+
+    glm::vec2 TileLayerComponent::getChunkTextureSize() const
+    {
+        return {
+            static_cast<float>((CHUNK_SIZE + overhang_.x) * tile_size_.x),
+            static_cast<float>((CHUNK_SIZE + overhang_.y) * tile_size_.y)
+        };
+    }
+
+    bool TileLayerComponent::bakeChunk(engine::render::Renderer& renderer, int chunk_x, int chunk_y)
+    {
+        auto& chunk = chunks_[static_cast<size_t>(chunk_y) * chunk_count_.x + chunk_x];
+        if (!chunk.texture) {
+            auto size = getChunkTextureSize();
+            chunk.texture.reset(renderer.createRenderTarget(static_cast<int>(size.x), static_cast<int>(size.y)));
+            if (!chunk.texture) return false;
+        }
+        if (!renderer.beginRenderTarget(chunk.texture.get())) return false;
+
+        // 以块纹理左上角为原点绘制块中的所有瓦片
+        auto origin = getChunkTextureOrigin(chunk_x, chunk_y);
+        for (auto index : chunk.tiles) {
+            int x = static_cast<int>(index % static_cast<std::uint32_t>(map_size_.x));
+            int y = static_cast<int>(index / static_cast<std::uint32_t>(map_size_.x));
+            renderer.drawUISprite(tiles_[index].sprite, getTileDrawPosition(x, y) - origin);
+        }
+        renderer.endRenderTarget();
+        chunk.dirty = false;
+        ENGINE_LOG_TRACE("TileLayerComponent 烘焙块 ({}, {})，瓦片数: {}", chunk_x, chunk_y, chunk.tiles.size());
+        return true;
     }
 
     void TileLayerComponent::render(engine::core::Context& context) {
-        if (tile_size_.x <= 0 || tile_size_.y <= 0) {
+        ENGINE_PROFILE_SCOPE("TileLayerComponent::render");
+        if (tile_size_.x <= 0 || tile_size_.y <= 0 || chunks_.empty()) {
             return; // 防止除以零或无效尺寸
         }
-        // 遍历所有瓦片
-        for (int y = 0; y < map_size_.y; ++y) {
-            for (int x = 0; x < map_size_.x; ++x) {
-                size_t index = static_cast<size_t>(y) * map_size_.x + x;
-                // 检查索引有效性以及瓦片是否需要渲染
-                if (index < tiles_.size() && tiles_[index].type != TileType::EMPTY) {
-                    const auto& tile_info = tiles_[index];
-                    // 计算该瓦片在世界中的左上角位置 (drawSprite 预期接收左上角坐标)
-                    glm::vec2 tile_left_top_pos = {
-                        offset_.x + static_cast<float>(x) * tile_size_.x,
-                        offset_.y + static_cast<float>(y) * tile_size_.y
-                    };
-                    // 但如果图片的大小与瓦片的大小不一致，需要调整 y 坐标 (瓦片层的对齐点是左下角)
-                    if (static_cast<int>(tile_info.sprite.getSourceRect()->h) != tile_size_.y) {
-                        tile_left_top_pos.y -= (tile_info.sprite.getSourceRect()->h - static_cast<float>(tile_size_.y));
+        auto& renderer = context.getRenderer();
+        const auto& camera = context.getCamera();
+
+        // 计算与相机视口重叠的瓦片范围 [start, end)
+        auto view_min = camera.getPosition() - offset_;
+        auto view_max = view_min + camera.getViewportSize();
+        // 瓦片图片可能向右、向上超出瓦片尺寸，因此视口左侧、下方之外的几列/行也可能可见
+        auto start_x = std::max(static_cast<int>(std::floor(view_min.x / tile_size_.x)) - overhang_.x, 0);
+        auto start_y = std::max(static_cast<int>(std::floor(view_min.y / tile_size_.y)), 0);
+        auto end_x = std::min(static_cast<int>(std::floor(view_max.x / tile_size_.x)) + 1, map_size_.x);
+        auto end_y = std::min(static_cast<int>(std::floor(view_max.y / tile_size_.y)) + 1 + overhang_.y, map_size_.y);
+        if (start_x >= end_x || start_y >= end_y) return;
+
+        // 只遍历与可见范围重叠的块
+        for (int chunk_y = start_y / CHUNK_SIZE; chunk_y <= (end_y - 1) / CHUNK_SIZE; ++chunk_y) {
+            for (int chunk_x = start_x / CHUNK_SIZE; chunk_x <= (end_x - 1) / CHUNK_SIZE; ++chunk_x) {
+                auto& chunk = chunks_[static_cast<size_t>(chunk_y) * chunk_count_.x + chunk_x];
+                if (chunk.tiles.empty()) continue;
+
+                // 烘焙模式：每个块一次绘制调用 (需要时先重新烘焙)
+                if (chunk_baking_enabled_) {
+                    if (!chunk.dirty || bakeChunk(renderer, chunk_x, chunk_y)) {
+                        renderer.drawTexture(camera, chunk.texture.get(), getChunkTextureOrigin(chunk_x, chunk_y), getChunkTextureSize());
+                        continue;
                     }
+                    // 烘焙失败（例如渲染器不支持渲染目标），关闭烘焙并回退到逐瓦片绘制
+                    spdlog::warn("TileLayerComponent 块烘焙失败，回退到逐瓦片绘制。");
+                    setChunkBakingEnabled(false);
+                }
+
+                for (auto index : chunk.tiles) {
+                    int x = static_cast<int>(index % static_cast<std::uint32_t>(map_size_.x));
+                    int y = static_cast<int>(index / static_cast<std::uint32_t>(map_size_.x));
+                    if (x < start_x || x >= end_x || y < start_y || y >= end_y) continue;   // 块的边缘部分可能在视口外
                     // 执行绘制
-                    context.getRenderer().drawSprite(context.getCamera(), tile_info.sprite, tile_left_top_pos);
+                    renderer.drawSprite(camera, tiles_[index].sprite, getTileDrawPosition(x, y));
                 }
             }
         }
     }
 
+    void TileLayerComponent::setTileAt(glm::ivec2 pos, TileInfo tile)
+    {
+        if (pos.x < 0 || pos.x >= map_size_.x || pos.y < 0 || pos.y >= map_size_.y) {
+            spdlog::warn("TileLayerComponent: setTileAt 瓦片坐标越界: ({}, {})", pos.x, pos.y);
+            return;
+        }
+        auto index = static_cast<size_t>(pos.y) * map_size_.x + pos.x;
+        tiles_[index] = std::move(tile);
+        tile_types_[index] = static_cast<std::uint8_t>(tiles_[index].type);
+
+        // 新瓦片的图片超出范围更大时，块纹理尺寸也会改变，需要全部重建
+        auto old_overhang = overhang_;
+        if (const auto& src_rect = tiles_[index].sprite.getSourceRect(); src_rect && tiles_[index].type != TileType::EMPTY) {
+            overhang_.x = std::max(overhang_.x, static_cast<int>(std::ceil((src_rect->w - tile_size_.x) / tile_size_.x)));
+            overhang_.y = std::max(overhang_.y, static_cast<int>(std::ceil((src_rect->h - tile_size_.y) / tile_size_.y)));
+        }
+        if (overhang_ != old_overhang) {
+            for (auto& chunk : chunks_) {
+                chunk.texture.reset();
+                chunk.dirty = true;
+            }
+        }
+        rebuildChunk(pos.x / CHUNK_SIZE, pos.y / CHUNK_SIZE);
+    }
+
+    void TileLayerComponent::setChunkBakingEnabled(bool enabled)
+    {
+        chunk_baking_enabled_ = enabled;
+        if (!chunk_baking_enabled_) {
+            // 释放已烘焙的纹理
+            for (auto& chunk : chunks_) {
+                chunk.texture.reset();
+                chunk.dirty = true;
+            }
+        }
+    }
+
+    void TileLayerComponent::invalidateBakedChunks(bool release_textures)
+    {
+        for (auto& chunk : chunks_) {
+            if (release_textures) chunk.texture.reset();
+            chunk.dirty = true;
+        }
+    }
+
     void TileLayerComponent::clean()
     {
+        chunks_.clear();    // 释放烘焙纹理 (此时渲染器仍然有效)
         if (physics_engine_) {
             physics_engine_->unregisterCollisionLayer(this);
         }
@@ -64,7 +246,7 @@ namespace engine::component {
 
     const TileInfo* TileLayerComponent::getTileInfoAt(glm::ivec2 pos) const {
         if (pos.x < 0 || pos.x >= map_size_.x || pos.y < 0 || pos.y >= map_size_.y) {
-            spdlog::warn("TileLayerComponent: 瓦片坐标越界: ({}, {})", pos.x, pos.y);
+            ENGINE_LOG_TRACE("TileLayerComponent: 瓦片坐标越界: ({}, {})", pos.x, pos.y);   // 查询地图外的瓦片是正常情况（例如物体走出地图边缘）
             return nullptr;
         }
         size_t index = static_cast<size_t>(pos.y * map_size_.x + pos.x);
@@ -77,8 +259,11 @@ namespace engine::component {
     }
 
     TileType TileLayerComponent::getTileTypeAt(glm::ivec2 pos) const {
-        const TileInfo* info = getTileInfoAt(pos);
-        return info ? info->type : TileType::EMPTY;
+        if (pos.x < 0 || pos.x >= map_size_.x || pos.y < 0 || pos.y >= map_size_.y) {
+            ENGINE_LOG_TRACE("TileLayerComponent: 瓦片坐标越界: ({}, {})", pos.x, pos.y);
+            return TileType::EMPTY;
+        }
+        return getTileTypeUnchecked(pos);
     }
 
     TileType TileLayerComponent::getTileTypeAtWorldPos(const glm::vec2& world_pos) const {
@@ -2,10 +2,14 @@
 #include "../render/sprite.h"
 #include "component.h"
 #include <vector>
+#include <memory>
+#include <cstdint>
 #include <glm/vec2.hpp>
 
 namespace engine::render {
     class Sprite;
+    class Renderer;
+    class Camera;
 }
 
 namespace engine::core {
@@ -20,7 +24,7 @@ namespace engine::component {
     /**
      * @brief 定义瓦片的类型，用于游戏逻辑（例如碰撞）。
      */
-    enum class TileType {
+    enum class TileType : std::uint8_t {
         EMPTY,      ///< @brief 空白瓦片
         NORMAL,     ///< @brief 普通瓦片
         SOLID,      ///< @brief 静止可碰撞瓦片
@@ -48,17 +52,39 @@ namespace engine::component {
      * @brief 管理和渲染瓦片地图层。
      *
      * 存储瓦片地图的布局、每个瓦片的精灵信息和类型。
-     * 负责在渲染阶段绘制可见的瓦片。
+     * 负责在渲染阶段绘制可见的瓦片：地图被划分为 CHUNK_SIZE x CHUNK_SIZE 的块，只处理与相机视口重叠的块。
+     * 启用块烘焙时，每个块预先绘制到一张渲染目标纹理上，每帧每个可见块只需一次绘制调用；块中瓦片改变时才重新烘焙。
      */
     class TileLayerComponent final : public Component {
         friend class engine::object::GameObject;
+    public:
+        static constexpr int CHUNK_SIZE = 32;   ///< @brief 渲染分块的边长（瓦片数）
+
     private:
+        /// @brief SDL_Texture 删除器，用于管理烘焙纹理
+        struct SDLTextureDeleter {
+            void operator()(SDL_Texture* texture) const;
+        };
+
+        /// @brief 渲染分块
+        struct TileChunk {
+            std::vector<std::uint32_t> tiles;   ///< @brief 块中非空瓦片在 tiles_ 中的索引（行主序）
+            std::unique_ptr<SDL_Texture, SDLTextureDeleter> texture;   ///< @brief 烘焙的纹理（未烘焙时为空）
+            bool dirty = true;                  ///< @brief 烘焙纹理是否需要更新
+        };
+
         glm::ivec2 tile_size_;              ///< @brief 单个瓦片尺寸（像素）
         glm::ivec2 map_size_;               ///< @brief 地图尺寸（瓦片数）
         std::vector<TileInfo> tiles_;       ///< @brief 存储所有瓦片信息 (按"行主序"存储, index = y * map_width_ + x)
+        /// @brief 紧凑的瓦片类型网格（每个瓦片1字节，与 tiles_ 同样的行主序），构造时生成，供物理查询使用
+        std::vector<std::uint8_t> tile_types_;
+        std::vector<TileChunk> chunks_;         ///< @brief 渲染分块（按行主序排列），渲染时只访问与相机视口重叠的块
+        glm::ivec2 chunk_count_ = { 0, 0 };     ///< @brief 分块数量 (x, y)
+        glm::ivec2 overhang_ = { 0, 0 };        ///< @brief 瓦片图片大于瓦片尺寸时向右/向上超出的最大列/行数（剔除时需要多看几列/行）
         glm::vec2 offset_ = { 0.0f, 0.0f };   ///< @brief 瓦片层在世界中的偏移量 (瓦片层通常不需要缩放及旋转，因此不引入Transform组件)
         // offset_ 最好也保持默认的0，以免增加不必要的复杂性
         bool is_hidden_ = false;            ///< @brief 是否隐藏（不渲染）
+        bool chunk_baking_enabled_ = false; ///< @brief 是否将块烘焙为纹理（适用于静态图层）
         engine::physics::PhysicsEngine* physics_engine_ = nullptr;   ///< @brief 物理引擎的指针， clean()函数中可能需要反注册
 
     public:
@@ -93,6 +119,36 @@ namespace engine::component {
          */
         TileType getTileTypeAtWorldPos(const glm::vec2& world_pos) const;
 
+        /**
+         * @brief 修改指定位置的瓦片，同时更新类型网格和分块，并标记所在块需要重新烘焙
+         * @param pos 瓦片坐标 (0 <= x < map_size_.x, 0 <= y < map_size_.y)
+         * @param tile 新的瓦片信息
+         */
+        void setTileAt(glm::ivec2 pos, TileInfo tile);
+
+        /**
+         * @brief 快速获取瓦片类型（供物理引擎等热路径使用）
+         *
+         * 只读取紧凑类型网格，越界时静默返回 TileType::EMPTY（不输出日志）。
+         * @param pos 瓦片坐标
+         */
+        TileType getTileTypeFast(glm::ivec2 pos) const {
+            // 负数转换为无符号后必然超出范围，一次比较即可完成两侧的边界检查
+            if (static_cast<unsigned>(pos.x) >= static_cast<unsigned>(map_size_.x) ||
+                static_cast<unsigned>(pos.y) >= static_cast<unsigned>(map_size_.y)) {
+                return TileType::EMPTY;
+            }
+            return getTileTypeUnchecked(pos);
+        }
+
+        /**
+         * @brief 不做边界检查的瓦片类型查询
+         * @param pos 瓦片坐标，调用者必须保证 0 <= x < map_size_.x, 0 <= y < map_size_.y
+         */
+        TileType getTileTypeUnchecked(glm::ivec2 pos) const {
+            return static_cast<TileType>(tile_types_[static_cast<size_t>(pos.y) * static_cast<size_t>(map_size_.x) + static_cast<size_t>(pos.x)]);
+        }
+
         // getters and setters
         glm::ivec2 getTileSize() const { return tile_size_; }               ///< @brief 获取单个瓦片尺寸
         glm::ivec2 getMapSize() const { return map_size_; }                 ///< @brief 获取地图尺寸
@@ -105,8 +161,20 @@ namespace engine::component {
 
         void setOffset(const glm::vec2& offset) { offset_ = offset; }       ///< @brief 设置瓦片层的偏移量
         void setHidden(bool hidden) { is_hidden_ = hidden; }                ///< @brief 设置是否隐藏（不渲染）
+        void setChunkBakingEnabled(bool enabled);                           ///< @brief 设置是否将块烘焙为纹理（关闭时释放已烘焙的纹理）
+        bool isChunkBakingEnabled() const { return chunk_baking_enabled_; } ///< @brief 获取是否将块烘焙为纹理
+        /// @brief 标记所有块需要重新烘焙（渲染目标内容丢失后）。release_textures 为 true 时同时释放块纹理（渲染设备重置后需要重新创建）
+        void invalidateBakedChunks(bool release_textures = false);
         void setPhysicsEngine(engine::physics::PhysicsEngine* physics_engine) { physics_engine_ = physics_engine; }
 
+    private:
+        void buildChunks();                     ///< @brief 构建渲染分块（构造时调用）
+        void rebuildChunk(int chunk_x, int chunk_y);                        ///< @brief 重新收集指定块中的非空瓦片
+        glm::vec2 getTileDrawPosition(int x, int y) const;                  ///< @brief 获取瓦片图片在世界中的左上角位置（考虑图片高于瓦片的情况）
+        glm::vec2 getChunkTextureOrigin(int chunk_x, int chunk_y) const;    ///< @brief 获取块烘焙纹理的世界左上角位置（包含向上超出的区域）
+        glm::vec2 getChunkTextureSize() const;                              ///< @brief 获取块烘焙纹理的尺寸（包含向右、向上超出的区域）
+        bool bakeChunk(engine::render::Renderer& renderer, int chunk_x, int chunk_y);   ///< @brief 将块烘焙到纹理，失败返回 false
+
     protected:
         // 核心循环方法
         void init() override;
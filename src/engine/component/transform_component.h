@@ -1,6 +1,7 @@
 #pragma once
 #include "./component.h"
 #include <glm/vec2.hpp>
+#include <glm/common.hpp>
 
 namespace engine::component {
 
@@ -15,6 +16,12 @@ namespace engine::component {
         glm::vec2 scale_ = { 1.0f, 1.0f };        ///< @brief 缩放
         float rotation_ = 0.0f;                 ///< @brief 角度制，单位：度
 
+    private:
+        glm::vec2 previous_position_ = { 0.0f, 0.0f };  ///< @brief 上一个物理步开始时的位置，用于渲染插值
+        bool interpolate_ = false;                      ///< @brief 是否已由物理引擎记录了上一状态（只有物理刚体需要插值）
+
+    public:
+
         /**
          * @brief 构造函数
          * @param position 位置
@@ -35,11 +42,21 @@ namespace engine::component {
         const glm::vec2& getPosition() const { return position_; }              ///< @brief 获取位置
         float getRotation() const { return rotation_; }                         ///< @brief 获取旋转
         const glm::vec2& getScale() const { return scale_; }                    ///< @brief 获取缩放
-        void setPosition(const glm::vec2& position) { position_ = position; }   ///< @brief 设置位置
+        void setPosition(const glm::vec2& position) { position_ = position; previous_position_ = position; }   ///< @brief 设置位置（瞬移，不做插值）
         void setRotation(float rotation) { rotation_ = rotation; }              ///< @brief 设置旋转
         void setScale(const glm::vec2& scale);                                  ///< @brief 设置缩放，应用缩放时应同步更新Sprite偏移量
         void translate(const glm::vec2& offset) { position_ += offset; }        ///< @brief 平移
 
+        // --- 渲染插值 (固定步长物理) ---
+        /// @brief 记录当前位置作为上一状态 (由物理引擎在每个物理步开始前调用)
+        void savePreviousPosition() { previous_position_ = position_; interpolate_ = true; }
+        /// @brief 停止插值，渲染位置与实际位置一致 (刚体注销时调用)
+        void resetInterpolation() { previous_position_ = position_; interpolate_ = false; }
+        /// @brief 获取用于渲染的插值位置，alpha 为当前帧在两个物理步之间的进度 [0, 1]
+        glm::vec2 getInterpolatedPosition(float alpha) const {
+            return interpolate_ ? glm::mix(previous_position_, position_, alpha) : position_;
+        }
+
     private:
         void update(float, engine::core::Context&) override {}                  ///< @brief 覆盖纯虚函数，这里不需要实现
     };
@@ -1,6 +1,7 @@
 #include "config.h"
 #include <fstream>
 #include <nlohmann/json.hpp>
+#include "log.h"
 #include "spdlog/spdlog.h"
 
 namespace engine::core {
@@ -64,15 +65,31 @@ namespace engine::core {
         if (j.contains("graphics")) {
             const auto& graphics_config = j["graphics"];
             vsync_enabled_ = graphics_config.value("vsync", vsync_enabled_);
+            batch_rendering_ = graphics_config.value("batch_rendering", batch_rendering_);
         }
         if (j.contains("performance")) {
             const auto& perf_config = j["performance"];
             target_fps_ = perf_config.value("target_fps", target_fps_);
+            show_frame_counters_ = perf_config.value("show_frame_counters", show_frame_counters_);
             if (target_fps_ < 0) {
                 spdlog::warn("目标 FPS 不能为负数。设置为 0（无限制）。");
                 target_fps_ = 0;
             }
         }
+        if (j.contains("physics")) {
+            const auto& physics_config = j["physics"];
+            physics_fixed_timestep_ = physics_config.value("fixed_timestep", physics_fixed_timestep_);
+            physics_update_rate_ = physics_config.value("update_rate", physics_update_rate_);
+            physics_max_substeps_ = physics_config.value("max_substeps", physics_max_substeps_);
+            if (physics_update_rate_ <= 0) {
+                spdlog::warn("物理更新频率必须为正数。设置为 120。");
+                physics_update_rate_ = 120;
+            }
+            if (physics_max_substeps_ <= 0) {
+                spdlog::warn("物理最大子步数必须为正数。设置为 1。");
+                physics_max_substeps_ = 1;
+            }
+        }
         if (j.contains("audio")) {
             const auto& audio_config = j["audio"];
             music_volume_ = audio_config.value("music_volume", music_volume_);
@@ -87,14 +104,14 @@ namespace engine::core {
                 auto input_mappings = mappings_json.get<std::unordered_map<std::string, std::vector<std::string>>>();
                 // 如果成功，则将 input_mappings 移动到 input_mappings_
                 input_mappings_ = std::move(input_mappings);
-                spdlog::trace("成功从配置加载输入映射。");
+                ENGINE_LOG_TRACE("成功从配置加载输入映射。");
             }
             catch (const std::exception& e) {
                 spdlog::warn("配置加载警告：解析 'input_mappings' 时发生异常。使用默认映射。错误：{}", e.what());
             }
         }
         else {
-            spdlog::trace("配置跟踪：未找到 'input_mappings' 部分或不是对象。使用头文件中定义的默认映射。");
+            ENGINE_LOG_TRACE("配置跟踪：未找到 'input_mappings' 部分或不是对象。使用头文件中定义的默认映射。");
         }
     }
 
@@ -107,10 +124,17 @@ namespace engine::core {
                 {"resizable", window_resizable_}
             }},
             {"graphics", {
-                {"vsync", vsync_enabled_}
+                {"vsync", vsync_enabled_},
+                {"batch_rendering", batch_rendering_}
             }},
             {"performance", {
-                {"target_fps", target_fps_}
+                {"target_fps", target_fps_},
+                {"show_frame_counters", show_frame_counters_}
+            }},
+            {"physics", {
+                {"fixed_timestep", physics_fixed_timestep_},
+                {"update_rate", physics_update_rate_},
+                {"max_substeps", physics_max_substeps_}
             }},
             {"audio", {
                 {"music_volume", music_volume_},
@@ -23,9 +23,16 @@ namespace engine::core {
 
         // 图形设置
         bool vsync_enabled_ = true;             ///< @brief 是否启用垂直同步
+        bool batch_rendering_ = true;           ///< @brief 是否启用精灵批处理渲染 (SDL_RenderGeometry)
 
         // 性能设置
         int target_fps_ = 144;                  ///< @brief 目标 FPS 设置，0 表示不限制
+        bool show_frame_counters_ = false;      ///< @brief 启动时是否显示每帧计数器叠加层（运行中可用 "counters_overlay" 动作切换）
+
+        // 物理设置
+        bool physics_fixed_timestep_ = true;    ///< @brief 是否使用固定时间步长更新物理（渲染时插值）
+        int physics_update_rate_ = 120;         ///< @brief 固定步长模式下每秒的物理更新次数 (Hz)
+        int physics_max_substeps_ = 8;          ///< @brief 每帧最多执行的物理子步数，防止卡顿后"死亡螺旋"
 
         // 音频设置
         float music_volume_ = 0.5f;
@@ -41,6 +48,8 @@ namespace engine::core {
             {"jump", {"J", "Space"}},
             {"attack", {"K", "MouseLeft"}},
             {"pause", {"P", "Escape"}},
+            {"profiler_dump", {"F9"}},
+            {"counters_overlay", {"F3"}},
             // 可以继续添加更多默认动作
         };
 
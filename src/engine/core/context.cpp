@@ -4,6 +4,7 @@
 #include "../render/camera.h"
 #include "../resource/resource_manager.h"
 #include "../physics/physics_engine.h"
+#include "log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::core {
@@ -19,7 +20,13 @@ namespace engine::core {
         resource_manager_(resource_manager),
         physics_engine_(physics_engine)
     {
-        spdlog::trace("上下文已创建并初始化，包含输入管理器、渲染器、相机和资源管理器。");
+        // 物理引擎每帧的临时结果（碰撞对、触发事件）使用帧分配器
+        physics_engine_.setFrameResource(&frame_arena_);
+        // 各系统向计数器注册表报告每帧的工作量
+        renderer_.setFrameCounters(&frame_counters_);
+        physics_engine_.setFrameCounters(&frame_counters_);
+        resource_manager_.setFrameCounters(&frame_counters_);
+        ENGINE_LOG_TRACE("上下文已创建并初始化，包含输入管理器、渲染器、相机和资源管理器。");
     }
 
 } // namespace engine::core 
\ No newline at end of file
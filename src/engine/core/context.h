@@ -1,4 +1,7 @@
 #pragma once
+#include "frame_arena.h"
+#include "frame_counters.h"
+
 // 前置声明核心系统
 namespace engine::input {
     class InputManager;
@@ -32,6 +35,8 @@ namespace engine::core {
         engine::render::Camera& camera_;                        ///< @brief 相机
         engine::resource::ResourceManager& resource_manager_;   ///< @brief 资源管理器
         engine::physics::PhysicsEngine& physics_engine_;        ///< @brief 物理引擎
+        FrameArena frame_arena_;                                ///< @brief 每帧重置的临时内存分配器（由 Context 拥有）
+        FrameCounters frame_counters_;                          ///< @brief 每帧计数器（由 Context 拥有）
 
     public:
         /**
@@ -60,6 +65,8 @@ namespace engine::core {
         engine::render::Camera& getCamera() const { return camera_; }                               ///< @brief 获取相机
         engine::resource::ResourceManager& getResourceManager() const { return resource_manager_; } ///< @brief 获取资源管理器
         engine::physics::PhysicsEngine& getPhysicsEngine() const { return physics_engine_; }         ///< @brief 获取物理引擎
+        FrameArena& getFrameArena() { return frame_arena_; }                                       ///< @brief 获取帧分配器（数据只在当前帧有效）
+        FrameCounters& getFrameCounters() { return frame_counters_; }                              ///< @brief 获取每帧计数器
 
     };
 
@@ -0,0 +1,56 @@
+#include "frame_arena.h"
+#include <algorithm>
+#include <cstdint>
+#include "log.h"
+#include <spdlog/spdlog.h>
+
+namespace engine::core {
+
+    FrameArena::FrameArena(std::size_t capacity, std::pmr::memory_resource* upstream)
+        : buffer_(std::make_unique<std::byte[]>(capacity)), capacity_(capacity), upstream_(upstream)
+    {
+        ENGINE_LOG_TRACE("FrameArena 构造成功，缓冲区大小 {} 字节。", capacity_);
+    }
+
+    FrameArena::~FrameArena() {
+        releaseOverflow();
+    }
+
+    void FrameArena::reset() {
+        peak_bytes_ = std::max(peak_bytes_, getUsedBytes());
+        if (overflow_bytes_ > 0) {
+            // 上一帧缓冲区不够用：归还上游内存，并把缓冲区扩大到能容纳整帧数据（留出一倍余量）
+            releaseOverflow();
+            capacity_ = std::max(capacity_ * 2, peak_bytes_ * 2);
+            buffer_ = std::make_unique<std::byte[]>(capacity_);
+            ENGINE_LOG_DEBUG("FrameArena 缓冲区扩大到 {} 字节。", capacity_);
+        }
+        offset_ = 0;
+    }
+
+    void* FrameArena::do_allocate(std::size_t bytes, std::size_t alignment) {
+        // 在主缓冲区中按对齐要求移动偏移量
+        auto base = reinterpret_cast<std::uintptr_t>(buffer_.get());
+        auto aligned = (base + offset_ + alignment - 1) & ~(static_cast<std::uintptr_t>(alignment) - 1);
+        auto new_offset = static_cast<std::size_t>(aligned - base) + bytes;
+        if (new_offset <= capacity_) {
+            offset_ = new_offset;
+            return reinterpret_cast<void*>(aligned);
+        }
+
+        // 缓冲区不足，向上游申请（reset 时归还并扩大缓冲区）
+        void* pointer = upstream_->allocate(bytes, alignment);
+        overflow_blocks_.push_back({ pointer, bytes, alignment });
+        overflow_bytes_ += bytes;
+        return pointer;
+    }
+
+    void FrameArena::releaseOverflow() {
+        for (const auto& block : overflow_blocks_) {
+            upstream_->deallocate(block.pointer, block.bytes, block.alignment);
+        }
+        overflow_blocks_.clear();
+        overflow_bytes_ = 0;
+    }
+
+} // namespace engine::core
@@ -0,0 +1,60 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+namespace engine::core {
+
+    /**
+     * @brief 每帧重置的线性（bump）分配器，用于只在一帧内有效的临时数据。
+     *
+     * 实现 std::pmr::memory_resource，可直接交给 std::pmr 容器使用。分配只移动偏移量，释放是空操作，
+     * 所有内存在 reset() 时一次性回收。由 Context 拥有，GameApp::run 在每帧开始时调用 reset()。
+     * 缓冲区用尽时临时向上游（默认 new/delete）申请，并在下一次 reset() 时扩大缓冲区，之后的帧不再申请内存。
+     * @note 从本分配器分配的内存在 reset() 之后全部失效，使用者必须在每帧重新创建容器。
+     */
+    class FrameArena final : public std::pmr::memory_resource {
+    private:
+        /// @brief 缓冲区不足时向上游申请的内存块
+        struct OverflowBlock {
+            void* pointer;
+            std::size_t bytes;
+            std::size_t alignment;
+        };
+
+        std::unique_ptr<std::byte[]> buffer_;           ///< @brief 主缓冲区
+        std::size_t capacity_ = 0;                      ///< @brief 主缓冲区大小 (字节)
+        std::size_t offset_ = 0;                        ///< @brief 主缓冲区已使用的字节数
+        std::size_t overflow_bytes_ = 0;                ///< @brief 本帧向上游申请的字节数
+        std::size_t peak_bytes_ = 0;                    ///< @brief 历史单帧最大使用量 (字节)
+        std::vector<OverflowBlock> overflow_blocks_;    ///< @brief 本帧向上游申请的内存块 (reset 时归还)
+        std::pmr::memory_resource* upstream_;           ///< @brief 上游分配器
+
+    public:
+        static constexpr std::size_t DEFAULT_CAPACITY = 64 * 1024;     ///< @brief 默认缓冲区大小 (64KB)
+
+        explicit FrameArena(std::size_t capacity = DEFAULT_CAPACITY,
+            std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+        ~FrameArena() override;
+
+        // 禁止拷贝和移动（容器持有指向它的指针）
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+        FrameArena(FrameArena&&) = delete;
+        FrameArena& operator=(FrameArena&&) = delete;
+
+        void reset();                                                       ///< @brief 回收本帧的所有分配（必要时扩大缓冲区）
+
+        std::size_t getCapacity() const { return capacity_; }               ///< @brief 获取主缓冲区大小
+        std::size_t getUsedBytes() const { return offset_ + overflow_bytes_; }  ///< @brief 获取本帧已分配的字节数
+        std::size_t getPeakBytes() const { return peak_bytes_; }            ///< @brief 获取历史单帧最大使用量
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+        void do_deallocate(void*, std::size_t, std::size_t) override {}     // 单独释放为空操作，reset 时统一回收
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+        void releaseOverflow();                                             ///< @brief 归还所有上游内存块
+    };
+
+} // namespace engine::core
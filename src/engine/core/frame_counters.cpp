@@ -0,0 +1,29 @@
+#include "frame_counters.h"
+#include <algorithm>
+
+namespace engine::core {
+
+    CounterId FrameCounters::registerCounter(std::string_view name) {
+        if (auto id = findCounter(name)) {
+            return *id;
+        }
+        counters_.push_back({ std::string(name) });
+        return static_cast<CounterId>(counters_.size() - 1);
+    }
+
+    std::optional<CounterId> FrameCounters::findCounter(std::string_view name) const {
+        auto it = std::find_if(counters_.begin(), counters_.end(), [name](const Counter& counter) { return counter.name == name; });
+        if (it == counters_.end()) {
+            return std::nullopt;
+        }
+        return static_cast<CounterId>(it - counters_.begin());
+    }
+
+    void FrameCounters::beginFrame() {
+        for (auto& counter : counters_) {
+            counter.last_value = counter.value;
+            counter.value = 0;
+        }
+    }
+
+} // namespace engine::core
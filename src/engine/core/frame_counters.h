@@ -0,0 +1,54 @@
+#pragma once
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace engine::core {
+
+    using CounterId = std::uint32_t;   ///< @brief 计数器编号（FrameCounters::registerCounter 的返回值）
+
+    /**
+     * @brief 每帧计数器的注册表，用来统计各系统每帧实际做了多少工作（绘制调用、瓦片查询、碰撞检测等）。
+     *
+     * 各系统在初始化时按名称注册计数器并保存返回的编号，之后每帧通过编号累加（只是数组下标访问）。
+     * 由 Context 拥有，GameApp::run 在每帧开始时调用 beginFrame()，把上一帧的结果保存下来并清零，
+     * 因此 getLastValue 得到的始终是上一帧完整的统计。
+     */
+    class FrameCounters final {
+    public:
+        /// @brief 一个计数器
+        struct Counter {
+            std::string name;               ///< @brief 名称，约定为 "系统.项目"，例如 "renderer.draw_calls"
+            std::uint64_t value = 0;        ///< @brief 本帧正在累计的值
+            std::uint64_t last_value = 0;   ///< @brief 上一帧的值
+        };
+
+    private:
+        std::vector<Counter> counters_;     ///< @brief 所有计数器（按注册顺序）
+
+    public:
+        FrameCounters() = default;
+
+        // 禁止拷贝和移动（各系统持有指向它的指针）
+        FrameCounters(const FrameCounters&) = delete;
+        FrameCounters& operator=(const FrameCounters&) = delete;
+        FrameCounters(FrameCounters&&) = delete;
+        FrameCounters& operator=(FrameCounters&&) = delete;
+
+        /// @brief 注册计数器并返回编号；同名计数器已存在时返回原编号（多个实例可以共用一个计数器）
+        CounterId registerCounter(std::string_view name);
+        std::optional<CounterId> findCounter(std::string_view name) const;          ///< @brief 按名称查找计数器
+
+        void add(CounterId id, std::uint64_t amount = 1) { counters_[id].value += amount; }    ///< @brief 累加本帧的值
+        void set(CounterId id, std::uint64_t value) { counters_[id].value = value; }           ///< @brief 直接设置本帧的值（用于对象数量等状态量）
+
+        void beginFrame();                                                          ///< @brief 保存上一帧的值并清零，开始新的一帧
+
+        std::uint64_t getValue(CounterId id) const { return counters_[id].value; }             ///< @brief 获取本帧目前累计的值
+        std::uint64_t getLastValue(CounterId id) const { return counters_[id].last_value; }    ///< @brief 获取上一帧的值
+        const std::vector<Counter>& getCounters() const { return counters_; }                  ///< @brief 获取所有计数器（用于显示和报告）
+    };
+
+} // namespace engine::core
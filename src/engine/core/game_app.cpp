@@ -2,18 +2,27 @@
 #include "time.h"
 #include "context.h"
 #include "config.h"
+#include "profiler.h"
 #include "../resource/resource_manager.h"
 #include "../render/renderer.h"
 #include "../render/camera.h"
+#include "../render/frame_counters_overlay.h"
 #include "../input/input_manager.h"
 #include "../physics/physics_engine.h"
 #include "../scene/scene_manager.h"
+#include "../scene/loading_scene.h"
 #include "../../game/scene/game_scene.h"
 #include <SDL3/SDL.h>
+#include "log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::core {
 
+    namespace {
+        constexpr const char* PROFILE_TRACE_PATH = "profile_trace.json";   ///< @brief 按下性能分析导出键时写入的文件
+        constexpr std::uint32_t PROFILE_TRACE_FRAMES = 300;                 ///< @brief 导出的帧数
+    }
+
     GameApp::GameApp() = default;
 
     GameApp::~GameApp() {
@@ -29,7 +38,12 @@ namespace engine::core {
             return;
         }
 
+        ENGINE_PROFILE_THREAD_NAME("Main");
         while (is_running_) {
+            ENGINE_PROFILE_FRAME();
+            ENGINE_PROFILE_SCOPE("GameApp::frame");
+            context_->getFrameArena().reset();  // 每帧开始时回收上一帧的临时内存
+            context_->getFrameCounters().beginFrame();  // 保存上一帧的计数并清零
             time_->update();
             float delta_time = time_->getDeltaTime();
             input_manager_->update();   // 每帧首先更新输入管理器
@@ -45,7 +59,7 @@ namespace engine::core {
     }
 
     bool GameApp::init() {
-        spdlog::trace("初始化 GameApp ...");
+        ENGINE_LOG_TRACE("初始化 GameApp ...");
         if (!initConfig()) return false;
         if (!initSDL())  return false;
         if (!initTime()) return false;
@@ -58,43 +72,68 @@ namespace engine::core {
         if (!initContext()) return false;
         if (!initSceneManager()) return false;
 
-        // 创建第一个场景并压入栈
+        // 创建第一个场景，在后台加载，期间显示加载场景
         auto scene = std::make_unique<game::scene::GameScene>("GameScene", *context_, *scene_manager_);
-        scene_manager_->requestPushScene(std::move(scene));
+        auto loading_scene = std::make_unique<engine::scene::LoadingScene>("LoadingScene", *context_, *scene_manager_);
+        scene_manager_->requestLoadScene(std::move(scene), std::move(loading_scene));
 
         is_running_ = true;
-        spdlog::trace("GameApp 初始化成功。");
+        ENGINE_LOG_TRACE("GameApp 初始化成功。");
         return true;
     }
 
     void GameApp::handleEvents() {
+        ENGINE_PROFILE_SCOPE("GameApp::handleEvents");
         if (input_manager_->shouldQuit()) {
-            spdlog::trace("GameApp 收到来自 InputManager 的退出请求。");
+            ENGINE_LOG_TRACE("GameApp 收到来自 InputManager 的退出请求。");
             is_running_ = false;
             return;
         }
 
+        // 渲染目标内容丢失时，通知场景重新烘焙（否则瓦片图层的块纹理会保持空白直到重新加载关卡）
+        if (input_manager_->isRenderTargetsReset()) {
+            scene_manager_->onRenderTargetsReset(input_manager_->isRenderDeviceReset());
+        }
+
+        // 导出最近若干帧的性能分析数据（Chrome trace 格式，可用 Perfetto 查看）
+        if (input_manager_->isActionPressed("profiler_dump")) {
+            Profiler::get().writeChromeTrace(PROFILE_TRACE_PATH, PROFILE_TRACE_FRAMES);
+        }
+        // 显示/隐藏每帧计数器
+        if (input_manager_->isActionPressed("counters_overlay")) {
+            counters_overlay_->toggle();
+        }
+
         scene_manager_->handleInput();
     }
 
     void GameApp::update(float delta_time) {
+        ENGINE_PROFILE_SCOPE("GameApp::update");
         // 游戏逻辑更新
         scene_manager_->update(delta_time);
     }
 
     void GameApp::render() {
+        ENGINE_PROFILE_SCOPE("GameApp::render");
         // 1. 清除屏幕
         renderer_->clearScreen();
 
         // 2. 具体渲染代码
         scene_manager_->render();
+        counters_overlay_->render(*renderer_, context_->getFrameCounters());
 
         // 3. 更新屏幕显示
+        ENGINE_PROFILE_SCOPE("Renderer::present");
         renderer_->present();
     }
 
     void GameApp::close() {
-        spdlog::trace("关闭 GameApp ...");
+        ENGINE_LOG_TRACE("关闭 GameApp ...");
+        if (time_) {
+            auto stats = time_->getFrameStats();
+            spdlog::info("帧时间统计（最近 {} 帧）: 平均 {:.2f} ms，p50 {:.2f} ms，p99 {:.2f} ms，1% low {:.1f} FPS，错过截止时间 {} 次。",
+                stats.frame_count, stats.mean_ms, stats.p50_ms, stats.p99_ms, stats.low_1_percent_fps, stats.missed_deadlines);
+        }
         // 先关闭场景管理器，确保所有场景都被清理
         scene_manager_->close();
 
@@ -122,7 +161,7 @@ namespace engine::core {
             spdlog::error("初始化配置失败: {}", e.what());
             return false;
         }
-        spdlog::trace("配置初始化成功。");
+        ENGINE_LOG_TRACE("配置初始化成功。");
         return true;
     }
 
@@ -148,11 +187,11 @@ namespace engine::core {
         // 设置 VSync (注意: VSync 开启时，驱动程序会尝试将帧率限制到显示器刷新率，有可能会覆盖我们手动设置的 target_fps)
         int vsync_mode = config_->vsync_enabled_ ? SDL_RENDERER_VSYNC_ADAPTIVE : SDL_RENDERER_VSYNC_DISABLED;
         SDL_SetRenderVSync(sdl_renderer_, vsync_mode);
-        spdlog::trace("VSync 设置为: {}", config_->vsync_enabled_ ? "Enabled" : "Disabled");
+        ENGINE_LOG_TRACE("VSync 设置为: {}", config_->vsync_enabled_ ? "Enabled" : "Disabled");
 
         // 设置逻辑分辨率为窗口大小的一半（针对像素游戏）
         SDL_SetRenderLogicalPresentation(sdl_renderer_, config_->window_width_ / 2, config_->window_height_ / 2, SDL_LOGICAL_PRESENTATION_LETTERBOX);
-        spdlog::trace("SDL 初始化成功。");
+        ENGINE_LOG_TRACE("SDL 初始化成功。");
         return true;
     }
 
@@ -165,7 +204,7 @@ namespace engine::core {
             return false;
         }
         time_->setTargetFps(config_->target_fps_);
-        spdlog::trace("时间管理初始化成功。");
+        ENGINE_LOG_TRACE("时间管理初始化成功。");
         return true;
     }
 
@@ -177,19 +216,21 @@ namespace engine::core {
             spdlog::error("初始化资源管理器失败: {}", e.what());
             return false;
         }
-        spdlog::trace("资源管理器初始化成功。");
+        ENGINE_LOG_TRACE("资源管理器初始化成功。");
         return true;
     }
 
     bool GameApp::initRenderer() {
         try {
             renderer_ = std::make_unique<engine::render::Renderer>(sdl_renderer_, resource_manager_.get());
+            renderer_->setBatchingEnabled(config_->batch_rendering_);
+            counters_overlay_ = std::make_unique<engine::render::FrameCountersOverlay>(config_->show_frame_counters_);
         }
         catch (const std::exception& e) {
             spdlog::error("初始化渲染器失败: {}", e.what());
             return false;
         }
-        spdlog::trace("渲染器初始化成功。");
+        ENGINE_LOG_TRACE("渲染器初始化成功。");
         return true;
     }
 
@@ -201,7 +242,7 @@ namespace engine::core {
             spdlog::error("初始化相机失败: {}", e.what());
             return false;
         }
-        spdlog::trace("相机初始化成功。");
+        ENGINE_LOG_TRACE("相机初始化成功。");
         return true;
     }
 
@@ -214,7 +255,7 @@ namespace engine::core {
             spdlog::error("初始化输入管理器失败: {}", e.what());
             return false;
         }
-        spdlog::trace("输入管理器初始化成功。");
+        ENGINE_LOG_TRACE("输入管理器初始化成功。");
         return true;
     }
 
@@ -222,12 +263,15 @@ namespace engine::core {
     {
         try {
             physics_engine_ = std::make_unique<engine::physics::PhysicsEngine>();
+            if (config_->physics_fixed_timestep_) {
+                physics_engine_->setFixedTimestep(1.0f / static_cast<float>(config_->physics_update_rate_), config_->physics_max_substeps_);
+            }
         }
         catch (const std::exception& e) {
             spdlog::error("初始化物理引擎失败: {}", e.what());
             return false;
         }
-        spdlog::trace("物理引擎初始化成功。");
+        ENGINE_LOG_TRACE("物理引擎初始化成功。");
         return true;
     }
 
@@ -252,7 +296,7 @@ namespace engine::core {
             spdlog::error("初始化场景管理器失败: {}", e.what());
             return false;
         }
-        spdlog::trace("场景管理器初始化成功。");
+        ENGINE_LOG_TRACE("场景管理器初始化成功。");
         return true;
     }
 
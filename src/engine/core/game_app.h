@@ -12,6 +12,7 @@ namespace engine::resource {
 namespace engine::render {
     class Renderer;
     class Camera;
+    class FrameCountersOverlay;
 }
 
 namespace engine::input {
@@ -45,6 +46,7 @@ namespace engine::core {        // 命名空间的最佳实践：与文件路径
         std::unique_ptr<engine::resource::ResourceManager> resource_manager_;
         std::unique_ptr<engine::render::Renderer> renderer_;
         std::unique_ptr<engine::render::Camera> camera_;
+        std::unique_ptr<engine::render::FrameCountersOverlay> counters_overlay_;
         std::unique_ptr<engine::core::Config> config_;
         std::unique_ptr<engine::input::InputManager> input_manager_;
         std::unique_ptr<engine::core::Context> context_;
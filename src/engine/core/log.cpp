@@ -0,0 +1,28 @@
+#include "log.h"
+#include <spdlog/async.h>
+#include <spdlog/sinks/stdout_color_sinks.h>
+
+namespace engine::core {
+
+    namespace {
+        constexpr size_t LOG_QUEUE_SIZE = 8192;     ///< @brief 异步日志队列能容纳的消息数
+    }
+
+    void initLogging(spdlog::level::level_enum level) {
+        spdlog::init_thread_pool(LOG_QUEUE_SIZE, 1);
+        auto sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+        // 队列满时覆盖最旧的消息，保证记录日志的线程永远不会等待
+        auto logger = std::make_shared<spdlog::async_logger>("engine", std::move(sink), spdlog::thread_pool(),
+                                                             spdlog::async_overflow_policy::overrun_oldest);
+        logger->set_level(level);
+        spdlog::set_default_logger(std::move(logger));
+    }
+
+    void shutdownLogging() {
+        spdlog::shutdown();     // 输出队列中的剩余消息并回收后台线程
+        // spdlog::shutdown 会移除所有 logger，换回同步的控制台 logger，保证之后（例如静态对象析构时）的日志仍可输出
+        auto logger = spdlog::stdout_color_mt("console");
+        spdlog::set_default_logger(std::move(logger));
+    }
+
+} // namespace engine::core
@@ -0,0 +1,45 @@
+#pragma once
+#include <spdlog/spdlog.h>
+
+/**
+ * @brief 编译期日志级别：低于该级别的 ENGINE_LOG_* 宏展开为空，参数不会被求值，也不会产生格式化开销。
+ *
+ * 取值与 spdlog 的级别一致（0 trace, 1 debug, 2 info, 3 warn, 4 error, 5 critical, 6 off）。
+ * 未定义时，Debug 构建保留全部日志，Release 构建 (NDEBUG) 去掉 trace 和 debug。
+ * 编译期保留的日志仍然受 spdlog 运行时级别 (spdlog::set_level) 控制。
+ */
+#ifndef ENGINE_LOG_LEVEL
+    #ifdef NDEBUG
+        #define ENGINE_LOG_LEVEL 2
+    #else
+        #define ENGINE_LOG_LEVEL 0
+    #endif
+#endif
+
+#if ENGINE_LOG_LEVEL <= 0
+    #define ENGINE_LOG_TRACE(...) spdlog::trace(__VA_ARGS__)
+#else
+    #define ENGINE_LOG_TRACE(...) ((void)0)
+#endif
+
+#if ENGINE_LOG_LEVEL <= 1
+    #define ENGINE_LOG_DEBUG(...) spdlog::debug(__VA_ARGS__)
+#else
+    #define ENGINE_LOG_DEBUG(...) ((void)0)
+#endif
+
+namespace engine::core {
+
+    /**
+     * @brief 初始化日志：把默认 logger 换成异步 logger（彩色控制台输出）。
+     *
+     * 调用线程只把日志消息放入队列，由后台线程负责格式化输出，因此游戏线程不会因控制台/文件 I/O 而阻塞。
+     * 队列满时丢弃最旧的消息而不是等待。应在 main 开始时调用，并在退出前调用 shutdownLogging()。
+     * @param level 运行时日志级别
+     */
+    void initLogging(spdlog::level::level_enum level);
+
+    /// @brief 输出队列中剩余的日志并停止后台线程（之后的日志仍会输出，但改为同步）
+    void shutdownLogging();
+
+} // namespace engine::core
@@ -0,0 +1,141 @@
+#include "profiler.h"
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <fstream>
+
+namespace engine::core {
+
+    Profiler& Profiler::get() {
+        static Profiler instance;
+        return instance;
+    }
+
+    Profiler::ThreadBuffer& Profiler::getThreadBuffer() {
+        // 每个线程第一次记录时取得缓冲区，线程结束时归还，以便短命的工作线程（例如后台加载）反复创建时不会不断占用新内存
+        struct ThreadSlot {
+            ThreadBuffer* buffer = nullptr;
+            ~ThreadSlot() {
+                if (buffer) Profiler::get().releaseThreadBuffer(buffer);
+            }
+        };
+        thread_local ThreadSlot slot;
+        if (slot.buffer) return *slot.buffer;
+
+        std::lock_guard lock(buffers_mutex_);
+        if (!free_buffers_.empty()) {
+            // 复用已结束线程的缓冲区：序号继续递增，旧线程的记录在导出时按 first_index 跳过
+            slot.buffer = free_buffers_.back();
+            free_buffers_.pop_back();
+        }
+        else {
+            auto new_buffer = std::make_shared<ThreadBuffer>();
+            new_buffer->slots = std::make_unique<EventSlot[]>(EVENTS_PER_THREAD);
+            buffers_.push_back(new_buffer);
+            slot.buffer = new_buffer.get();     // 由 buffers_ 持有，生命周期与分析器相同
+        }
+        std::lock_guard info_lock(slot.buffer->info_mutex);
+        slot.buffer->first_index = slot.buffer->committed.load(std::memory_order_relaxed);
+        slot.buffer->thread_id = next_thread_id_++;
+        slot.buffer->thread_name = "thread " + std::to_string(slot.buffer->thread_id);
+        return *slot.buffer;
+    }
+
+    void Profiler::releaseThreadBuffer(ThreadBuffer* buffer) {
+        // 保留记录直到被复用，线程刚结束时仍然可以导出它的数据
+        std::lock_guard lock(buffers_mutex_);
+        free_buffers_.push_back(buffer);
+    }
+
+    void Profiler::record(const char* name, std::int64_t start_ns, std::int64_t end_ns) {
+        // 只有当前线程写入自己的缓冲区，不需要加锁
+        auto& buffer = getThreadBuffer();
+        const auto index = buffer.committed.load(std::memory_order_relaxed);
+        buffer.claimed.store(index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);    // 导出线程看到新数据时，一定也能看到 claimed 的更新
+
+        auto& slot = buffer.slots[index % EVENTS_PER_THREAD];
+        slot.name.store(name, std::memory_order_relaxed);
+        slot.start_ns.store(start_ns, std::memory_order_relaxed);
+        slot.duration_ns.store(end_ns - start_ns, std::memory_order_relaxed);
+        slot.frame.store(frame_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        buffer.committed.store(index + 1, std::memory_order_release);
+    }
+
+    void Profiler::setThreadName(const std::string& name) {
+        if constexpr (!ENGINE_ENABLE_PROFILING) {
+            return;                 // 不会有事件记录，避免为线程分配事件缓冲区
+        }
+        auto& buffer = getThreadBuffer();
+        std::lock_guard lock(buffer.info_mutex);
+        buffer.thread_name = name;
+    }
+
+    bool Profiler::writeChromeTrace(const std::string& file_path, std::uint32_t frame_count) {
+        if constexpr (!ENGINE_ENABLE_PROFILING) {
+            spdlog::warn("性能分析在编译时已关闭 (ENGINE_ENABLE_PROFILING=0)，导出的 trace 中没有记录。");
+        }
+        // 只导出已结束的帧之前 frame_count 帧内开始的记录（帧号回绕的情况忽略不计）
+        const std::uint32_t current_frame = frame_;
+        const std::uint32_t first_frame = (frame_count == 0 || frame_count > current_frame) ? 0 : current_frame - frame_count;
+
+        nlohmann::json events = nlohmann::json::array();
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers;
+        {
+            std::lock_guard lock(buffers_mutex_);
+            buffers = buffers_;
+        }
+        std::vector<Event> copied;
+        for (const auto& buffer : buffers) {
+            std::uint64_t first_index = 0;
+            std::uint32_t thread_id = 0;
+            std::string thread_name;
+            {
+                std::lock_guard lock(buffer->info_mutex);
+                first_index = buffer->first_index;
+                thread_id = buffer->thread_id;
+                thread_name = buffer->thread_name;
+            }
+            events.push_back({
+                { "name", "thread_name" }, { "ph", "M" }, { "pid", 1 }, { "tid", thread_id },
+                { "args", { { "name", thread_name } } },
+            });
+
+            // 复制已写完的记录（从最旧的开始），写入线程可能同时在覆盖最旧的格子
+            const auto end = buffer->committed.load(std::memory_order_acquire);
+            const auto begin = std::max(first_index, end > EVENTS_PER_THREAD ? end - EVENTS_PER_THREAD : 0);
+            copied.clear();
+            for (auto index = begin; index < end; ++index) {
+                const auto& slot = buffer->slots[index % EVENTS_PER_THREAD];
+                copied.push_back(Event{
+                    slot.name.load(std::memory_order_relaxed), slot.start_ns.load(std::memory_order_relaxed),
+                    slot.duration_ns.load(std::memory_order_relaxed), slot.frame.load(std::memory_order_relaxed) });
+            }
+            // 复制期间被覆盖的格子（序号小于 claimed - 容量）内容可能不完整，丢弃
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const auto claimed = buffer->claimed.load(std::memory_order_relaxed);
+            const auto first_valid = std::max(begin, claimed > EVENTS_PER_THREAD ? claimed - EVENTS_PER_THREAD : 0);
+
+            for (auto index = first_valid; index < end; ++index) {
+                const auto& event = copied[index - begin];
+                if (event.frame < first_frame) continue;
+                events.push_back({
+                    { "name", event.name }, { "cat", "engine" }, { "ph", "X" }, { "pid", 1 }, { "tid", thread_id },
+                    { "ts", static_cast<double>(event.start_ns) / 1000.0 },        // 微秒
+                    { "dur", static_cast<double>(event.duration_ns) / 1000.0 },
+                    { "args", { { "frame", event.frame } } },
+                });
+            }
+        }
+
+        std::ofstream file(file_path);
+        if (!file.is_open()) {
+            spdlog::error("无法写入性能分析文件: {}", file_path);
+            return false;
+        }
+        file << nlohmann::json{ { "traceEvents", std::move(events) }, { "displayTimeUnit", "ms" } }.dump();
+        spdlog::info("性能分析数据已导出: {}（帧 {} - {}）", file_path, first_frame, current_frame);
+        return true;
+    }
+
+} // namespace engine::core
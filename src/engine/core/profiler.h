@@ -0,0 +1,160 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief 编译期开关：为 0 时，所有 ENGINE_PROFILE_* 宏展开为空，不产生任何开销。
+ *
+ * 未定义时，Debug 构建开启，Release 构建 (NDEBUG) 关闭；需要分析 Release 构建时可定义 ENGINE_ENABLE_PROFILING=1。
+ */
+#ifndef ENGINE_ENABLE_PROFILING
+    #ifdef NDEBUG
+        #define ENGINE_ENABLE_PROFILING 0
+    #else
+        #define ENGINE_ENABLE_PROFILING 1
+    #endif
+#endif
+
+namespace engine::core {
+
+    /**
+     * @brief 轻量的作用域性能分析器。
+     *
+     * 每个线程把记录的作用域（名称、开始时间、持续时间、帧号）写入自己的环形缓冲区，写满后覆盖最旧的记录，
+     * 因此不会分配内存，也不会无限增长。写入不加锁：缓冲区只有所属线程写入，导出时通过原子写入序号判断哪些记录完整有效。writeChromeTrace 把最近 N 帧的记录导出为 Chrome trace_event JSON，
+     * 可以用 Perfetto (ui.perfetto.dev) 或 chrome://tracing 查看。
+     * 通常只通过 ENGINE_PROFILE_SCOPE / ENGINE_PROFILE_FUNCTION / ENGINE_PROFILE_FRAME 宏使用。
+     */
+    class Profiler final {
+    public:
+        /// @brief 一条记录（Chrome trace 中的 "X" 完整事件）
+        struct Event {
+            const char* name = nullptr;     ///< @brief 名称（必须是静态存储期的字符串，例如字面量）
+            std::int64_t start_ns = 0;      ///< @brief 开始时间（相对于分析器创建时刻，纳秒）
+            std::int64_t duration_ns = 0;   ///< @brief 持续时间（纳秒）
+            std::uint32_t frame = 0;        ///< @brief 开始时的帧号
+        };
+
+        static constexpr std::size_t EVENTS_PER_THREAD = 64 * 1024;    ///< @brief 每个线程环形缓冲区的容量
+
+    private:
+        /// @brief 环形缓冲区中的一格（各字段为 relaxed 原子量，导出线程读取时与写入线程不构成数据竞争）
+        struct EventSlot {
+            std::atomic<const char*> name = nullptr;
+            std::atomic<std::int64_t> start_ns = 0;
+            std::atomic<std::int64_t> duration_ns = 0;
+            std::atomic<std::uint32_t> frame = 0;
+        };
+
+        /**
+         * @brief 每个线程的环形缓冲区（单写入者）。
+         *
+         * 第 n 条记录（n 从0开始单调递增）写在 slots[n % EVENTS_PER_THREAD]。写入前先把 claimed 置为 n+1，
+         * 写完后把 committed 置为 n+1：导出线程复制完记录后再读取 claimed，就能知道哪些格子在复制期间被覆盖了。
+         */
+        struct ThreadBuffer {
+            std::unique_ptr<EventSlot[]> slots;             ///< @brief 环形缓冲区
+            std::atomic<std::uint64_t> claimed = 0;         ///< @brief 已开始写入的记录数
+            std::atomic<std::uint64_t> committed = 0;       ///< @brief 已写完的记录数
+            std::mutex info_mutex;                          ///< @brief 保护以下字段（只在线程开始、改名和导出时访问）
+            std::uint64_t first_index = 0;                  ///< @brief 当前线程的第一条记录序号（之前的属于已结束的上一个线程）
+            std::uint32_t thread_id = 0;                    ///< @brief 线程编号（导出时作为 tid）
+            std::string thread_name;                        ///< @brief 线程名称
+        };
+
+        using Clock = std::chrono::steady_clock;
+
+        Clock::time_point epoch_ = Clock::now();                    ///< @brief 时间零点
+        std::atomic<bool> enabled_ = true;                          ///< @brief 运行时开关
+        std::atomic<std::uint32_t> frame_ = 0;                      ///< @brief 当前帧号
+        std::atomic<std::uint32_t> next_thread_id_ = 1;             ///< @brief 下一个线程编号
+        std::mutex buffers_mutex_;                                  ///< @brief 保护 buffers_
+        std::vector<std::shared_ptr<ThreadBuffer>> buffers_;        ///< @brief 所有线程的缓冲区（线程结束后仍保留，数据可以导出）
+        std::vector<ThreadBuffer*> free_buffers_;                   ///< @brief 线程已结束、可以被新线程复用的缓冲区
+
+        Profiler() = default;
+
+    public:
+        static Profiler& get();     ///< @brief 获取全局实例
+
+        // 禁止拷贝和移动
+        Profiler(const Profiler&) = delete;
+        Profiler& operator=(const Profiler&) = delete;
+        Profiler(Profiler&&) = delete;
+        Profiler& operator=(Profiler&&) = delete;
+
+        std::int64_t now() const {     ///< @brief 当前时间（相对于时间零点，纳秒）
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - epoch_).count();
+        }
+        void record(const char* name, std::int64_t start_ns, std::int64_t end_ns);  ///< @brief 记录一个作用域到当前线程的缓冲区
+        void markFrame() { ++frame_; }                                              ///< @brief 标记新的一帧开始（主循环每帧调用一次）
+        std::uint32_t getFrame() const { return frame_; }                           ///< @brief 获取当前帧号
+        void setThreadName(const std::string& name);                                ///< @brief 设置当前线程在 trace 中显示的名称（关闭性能分析时不做任何事）
+
+        void setEnabled(bool enabled) { enabled_ = enabled; }                       ///< @brief 设置运行时是否记录
+        bool isEnabled() const { return enabled_; }                                 ///< @brief 是否正在记录
+
+        /**
+         * @brief 导出最近 frame_count 帧的记录为 Chrome trace_event JSON 文件。
+         * @param file_path 输出文件路径
+         * @param frame_count 导出的帧数（0 表示缓冲区中的全部记录）
+         * @return 是否写入成功
+         */
+        bool writeChromeTrace(const std::string& file_path, std::uint32_t frame_count = 0);
+
+    private:
+        ThreadBuffer& getThreadBuffer();                ///< @brief 获取（首次调用时创建或复用）当前线程的缓冲区
+        void releaseThreadBuffer(ThreadBuffer* buffer); ///< @brief 线程结束时归还缓冲区
+    };
+
+    /**
+     * @brief RAII 作用域计时：构造时记录开始时间，析构时写入一条记录。
+     */
+    class ProfileScope final {
+    private:
+        const char* name_;
+        std::int64_t start_ns_;
+        bool active_;
+
+    public:
+        explicit ProfileScope(const char* name)
+            : name_(name), active_(Profiler::get().isEnabled()) {
+            start_ns_ = active_ ? Profiler::get().now() : 0;
+        }
+        ~ProfileScope() {
+            if (active_) {
+                auto& profiler = Profiler::get();
+                profiler.record(name_, start_ns_, profiler.now());
+            }
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+        ProfileScope(ProfileScope&&) = delete;
+        ProfileScope& operator=(ProfileScope&&) = delete;
+    };
+
+} // namespace engine::core
+
+#if ENGINE_ENABLE_PROFILING
+    #define ENGINE_PROFILE_CONCAT_IMPL(a, b) a##b
+    #define ENGINE_PROFILE_CONCAT(a, b) ENGINE_PROFILE_CONCAT_IMPL(a, b)
+    /// @brief 记录当前作用域，name 必须是字符串字面量
+    #define ENGINE_PROFILE_SCOPE(name) ::engine::core::ProfileScope ENGINE_PROFILE_CONCAT(profile_scope_, __LINE__)(name)
+    /// @brief 以函数名记录当前函数
+    #define ENGINE_PROFILE_FUNCTION() ENGINE_PROFILE_SCOPE(__func__)
+    /// @brief 标记新的一帧（主循环每帧开始时调用）
+    #define ENGINE_PROFILE_FRAME() ::engine::core::Profiler::get().markFrame()
+    /// @brief 设置当前线程在 trace 中显示的名称（线程入口处调用）
+    #define ENGINE_PROFILE_THREAD_NAME(name) ::engine::core::Profiler::get().setThreadName(name)
+#else
+    #define ENGINE_PROFILE_SCOPE(name) ((void)0)
+    #define ENGINE_PROFILE_FUNCTION() ((void)0)
+    #define ENGINE_PROFILE_FRAME() ((void)0)
+    #define ENGINE_PROFILE_THREAD_NAME(name) ((void)0)
+#endif
@@ -1,6 +1,8 @@
 #include "time.h"
+#include "log.h"
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL_timer.h>    // 用于 SDL_GetTicksNS()
+#include <algorithm>
 
 namespace engine::core {
 
@@ -8,31 +10,124 @@ namespace engine::core {
         // 初始化 last_time_ 和 frame_start_time_ 为当前时间，避免第一帧 DeltaTime 过大
         last_time_ = SDL_GetTicksNS();
         frame_start_time_ = last_time_;
-        spdlog::trace("Time 初始化。Last time: {}", last_time_);
+        frame_times_ms_.reserve(STATS_WINDOW);
+        ENGINE_LOG_TRACE("Time 初始化。Last time: {}", last_time_);
     }
 
     void Time::update() {
+        Uint64 now = SDL_GetTicksNS();
+        if (!started_) {
+            // 第一帧包含了初始化的耗时，不限制帧率也不计入统计
+            started_ = true;
+            frame_start_time_ = now;
+            delta_time_ = static_cast<double>(frame_start_time_ - last_time_) / 1000000000.0;
+            last_time_ = frame_start_time_;
+            return;
+        }
+        if (target_frame_ns_ > 0) {      // 如果设置了目标帧率，则等待到本帧的截止时间
+            now = limitFrameRate(now);
+        }
+
+        // 帧时间取相邻两帧开始时刻之差，等待的时间也计算在内
+        frame_start_time_ = now;
+        delta_time_ = static_cast<double>(frame_start_time_ - last_time_) / 1000000000.0;
+        last_time_ = frame_start_time_;
+        recordFrameTime(delta_time_ * 1000.0);
+    }
+
+    Uint64 Time::limitFrameRate(Uint64 now) {
+        if (next_deadline_ == 0) {      // 第一次限制帧率（或刚修改了目标帧率），从上一帧开始时计时
+            next_deadline_ = last_time_ + target_frame_ns_;
+        }
+
+        if (now >= next_deadline_) {
+            // 本帧的工作完成时已经超过截止时间，不再等待
+            if (now > next_deadline_) ++missed_deadlines_;
+            if (now - next_deadline_ >= target_frame_ns_) {
+                // 落后超过一整帧（例如加载时的卡顿）：从现在重新计时，而不是连续跑几帧追赶
+                next_deadline_ = now + target_frame_ns_;
+            }
+            else {
+                // 只是稍有延误：下一帧的截止时间保持原来的节奏，平均帧率不受影响
+                next_deadline_ += target_frame_ns_;
+            }
+            return now;
+        }
 
-        frame_start_time_ = SDL_GetTicksNS();   // 记录进入 update 时的时间戳
-        auto current_delta_time = static_cast<double>(frame_start_time_ - last_time_) / 1000000000.0;
-        if (target_frame_time_ > 0.0) {      // 如果设置了目标帧率，则限制帧率；否则delta_time_ = current_delta_time
-            limitFrameRate(current_delta_time);
+        // 先睡眠到截止时间前 spin_margin_ns_，睡眠的误差由之后的忙等吸收
+        if (next_deadline_ - now > spin_margin_ns_) {
+            SDL_DelayNS(next_deadline_ - now - spin_margin_ns_);
+        }
+        // 忙等到截止时间（通常不到 1 毫秒）
+        while ((now = SDL_GetTicksNS()) < next_deadline_) {
+        }
+
+        // 截止时间是绝对时间，每帧的误差不会累积到下一帧
+        next_deadline_ += target_frame_ns_;
+        return now;
+    }
+
+    void Time::recordFrameTime(double frame_time_ms) {
+        auto bin_of = [](float ms) {
+            return std::min(static_cast<size_t>(std::max(ms, 0.0f) / HISTOGRAM_BIN_MS), HISTOGRAM_BINS - 1);
+        };
+        const auto sample = static_cast<float>(frame_time_ms);
+        if (frame_times_ms_.size() < STATS_WINDOW) {
+            frame_times_ms_.push_back(sample);
         }
         else {
-            delta_time_ = current_delta_time;
+            // 窗口已满，移除最旧的一帧
+            auto& oldest = frame_times_ms_[next_sample_];
+            --histogram_[bin_of(oldest)];
+            window_sum_ms_ -= oldest;
+            oldest = sample;
+            next_sample_ = (next_sample_ + 1) % STATS_WINDOW;
         }
+        ++histogram_[bin_of(sample)];
+        window_sum_ms_ += sample;
+    }
 
-        last_time_ = SDL_GetTicksNS(); // 记录离开 update 时的时间戳
+    double Time::getHistogramValue(size_t rank) const {
+        size_t count = 0;
+        for (size_t bin = 0; bin < HISTOGRAM_BINS; ++bin) {
+            count += histogram_[bin];
+            if (count > rank) {
+                return (static_cast<double>(bin) + 0.5) * HISTOGRAM_BIN_MS;
+            }
+        }
+        return static_cast<double>(HISTOGRAM_BINS) * HISTOGRAM_BIN_MS;
     }
 
-    void Time::limitFrameRate(float current_delta_time) {
-        // 如果当前帧耗费的时间小于目标帧时间，则等待剩余时间
-        if (current_delta_time < target_frame_time_) {
-            double time_to_wait = target_frame_time_ - current_delta_time;
-            Uint64 ns_to_wait = static_cast<Uint64>(time_to_wait * 1000000000.0);
-            SDL_DelayNS(ns_to_wait);
-            delta_time_ = static_cast<double>(SDL_GetTicksNS() - last_time_) / 1000000000.0;
+    FrameStats Time::getFrameStats() const {
+        FrameStats stats;
+        stats.missed_deadlines = missed_deadlines_;
+        stats.frame_count = frame_times_ms_.size();
+        if (stats.frame_count == 0) return stats;
+
+        const auto last_rank = static_cast<double>(stats.frame_count - 1);
+        stats.mean_ms = window_sum_ms_ / static_cast<double>(stats.frame_count);
+        stats.p50_ms = getHistogramValue(static_cast<size_t>(last_rank * 0.50 + 0.5));
+        stats.p99_ms = getHistogramValue(static_cast<size_t>(last_rank * 0.99 + 0.5));
+
+        // 1% low：从最慢的区间开始，取出最慢的 1% 帧（至少一帧）求平均帧时间
+        size_t remaining = std::max<size_t>(stats.frame_count / 100, 1);
+        const size_t slow_count = remaining;
+        double slow_sum_ms = 0.0;
+        for (size_t bin = HISTOGRAM_BINS; bin-- > 0 && remaining > 0;) {
+            auto taken = std::min<size_t>(histogram_[bin], remaining);
+            slow_sum_ms += static_cast<double>(taken) * (static_cast<double>(bin) + 0.5) * HISTOGRAM_BIN_MS;
+            remaining -= taken;
         }
+        stats.low_1_percent_fps = 1000.0 / (slow_sum_ms / static_cast<double>(slow_count));
+        return stats;
+    }
+
+    void Time::resetFrameStats() {
+        frame_times_ms_.clear();
+        next_sample_ = 0;
+        histogram_.fill(0);
+        window_sum_ms_ = 0.0;
+        missed_deadlines_ = 0;
     }
 
     float Time::getDeltaTime() const {
@@ -64,12 +159,15 @@ namespace engine::core {
             target_fps_ = fps;
         }
 
+        next_deadline_ = 0;     // 下一帧重新开始计时
         if (target_fps_ > 0) {
             target_frame_time_ = 1.0 / static_cast<double>(target_fps_);
+            target_frame_ns_ = static_cast<Uint64>(1000000000.0 / static_cast<double>(target_fps_));
             spdlog::info("Target FPS 设置为: {} (Frame time: {:.6f}s)", target_fps_, target_frame_time_);
         }
         else {
             target_frame_time_ = 0.0;
+            target_frame_ns_ = 0;
             spdlog::info("Target FPS 设置为: Unlimited");
         }
     }
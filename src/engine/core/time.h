@@ -1,24 +1,59 @@
 #pragma once
 #include <SDL3/SDL_stdinc.h>    // 用于 Uint64
+#include <array>
+#include <cstdint>
+#include <vector>
 
 namespace engine::core {
 
+    /**
+     * @brief 最近若干帧的帧时间统计（见 Time::getFrameStats）。
+     */
+    struct FrameStats {
+        size_t frame_count = 0;             ///< @brief 统计窗口中的帧数
+        double mean_ms = 0.0;               ///< @brief 平均帧时间（毫秒）
+        double p50_ms = 0.0;                ///< @brief 帧时间中位数（毫秒）
+        double p99_ms = 0.0;                ///< @brief 99% 分位帧时间（毫秒）
+        double low_1_percent_fps = 0.0;     ///< @brief 1% low FPS：最慢的 1% 帧的平均帧时间换算成的帧率
+        std::uint64_t missed_deadlines = 0; ///< @brief 帧率限制模式下错过帧截止时间的次数（自上次重置起累计）
+    };
+
     /**
      * @brief 管理游戏循环中的时间，计算帧间时间差 (DeltaTime)。
      *
      * 使用 SDL 的高精度性能计数器来确保时间测量的准确性。
      * 提供获取缩放和未缩放 DeltaTime 的方法，以及设置时间缩放因子的能力。
+     *
+     * 限制帧率时，每帧的截止时间是绝对时间（上一个截止时间 + 目标帧时间），先睡眠到截止时间前 spin_margin，
+     * 再忙等到截止时间，因此操作系统定时器的误差既不会让帧时间抖动，也不会逐帧累积。
+     * 同时在一个滚动窗口中记录帧时间直方图，可随时查询中位数、99% 分位、1% low FPS 和错过截止时间的次数。
      */
     class Time final {
+    public:
+        static constexpr size_t STATS_WINDOW = 1000;            ///< @brief 统计最近多少帧
+        static constexpr double HISTOGRAM_BIN_MS = 0.1;         ///< @brief 直方图每个区间的宽度（毫秒）
+        static constexpr size_t HISTOGRAM_BINS = 1000;          ///< @brief 直方图区间数量（覆盖 0 ~ 100 毫秒，更长的帧计入最后一个区间）
+
     private:
-        Uint64 last_time_ = 0;         ///< @brief 上一帧的时间戳 (用于计算 delta)
-        Uint64 frame_start_time_ = 0;  ///< @brief 当前帧开始的时间戳 (用于帧率限制)
+        Uint64 last_time_ = 0;         ///< @brief 上一帧开始的时间戳 (用于计算 delta)
+        Uint64 frame_start_time_ = 0;  ///< @brief 当前帧开始的时间戳
         double delta_time_ = 0.0;      ///< @brief 未缩放的帧间时间差 (秒)
         double time_scale_ = 1.0;      ///< @brief 时间缩放因子
+        bool started_ = false;         ///< @brief 是否已经执行过第一次 update
 
         // 帧率限制相关
         int target_fps_ = 0;             ///< @brief 目标 FPS (0 表示不限制)
         double target_frame_time_ = 0.0; ///< @brief 目标每帧时间 (秒)
+        Uint64 target_frame_ns_ = 0;     ///< @brief 目标每帧时间 (纳秒)
+        Uint64 next_deadline_ = 0;       ///< @brief 下一帧开始的绝对截止时间 (纳秒，0 表示尚未开始计时)
+        Uint64 spin_margin_ns_ = 1000000;///< @brief 截止时间前多久停止睡眠、改为忙等 (纳秒)
+
+        // 帧时间统计
+        std::vector<float> frame_times_ms_;                     ///< @brief 最近 STATS_WINDOW 帧的帧时间（环形缓冲区）
+        size_t next_sample_ = 0;                                ///< @brief 下一次写入环形缓冲区的位置
+        std::array<std::uint32_t, HISTOGRAM_BINS> histogram_{}; ///< @brief 窗口内帧时间的直方图
+        double window_sum_ms_ = 0.0;                            ///< @brief 窗口内帧时间之和（毫秒）
+        std::uint64_t missed_deadlines_ = 0;                    ///< @brief 错过截止时间的次数
 
     public:
         Time();
@@ -77,13 +112,33 @@ namespace engine::core {
          */
         int getTargetFps() const;
 
+        /**
+         * @brief 设置忙等的时长：睡眠到截止时间前 margin_ns 纳秒为止，剩余时间忙等。
+         *
+         * @param margin_ns 应略大于操作系统睡眠的典型误差。越大帧时间越稳定，但占用更多 CPU；0 表示只睡眠。
+         */
+        void setSpinMargin(Uint64 margin_ns) { spin_margin_ns_ = margin_ns; }
+        Uint64 getSpinMargin() const { return spin_margin_ns_; }   ///< @brief 获取忙等时长（纳秒）
+
+        /**
+         * @brief 获取最近 STATS_WINDOW 帧的帧时间统计。
+         *
+         * 分位数由直方图得出，精度为 HISTOGRAM_BIN_MS。
+         */
+        FrameStats getFrameStats() const;
+        void resetFrameStats();    ///< @brief 清空帧时间统计和错过截止时间的计数
+
     private:
         /**
-         * @brief update 中调用，用于限制帧率。如果设置了 target_fps_ > 0，且当前帧执行时间小于目标帧时间，则会调用 SDL_DelayNS() 来等待剩余时间。
+         * @brief update 中调用，用于限制帧率：等待到 next_deadline_（先睡眠，最后 spin_margin_ns_ 忙等），并安排下一帧的截止时间。
          *
-         * @param current_delta_time 当前帧的执行时间（秒）
+         * @param now 当前时间戳（纳秒）
+         * @return 等待结束时的时间戳（纳秒），即本帧开始的时间
          */
-        void limitFrameRate(float current_delta_time);
+        Uint64 limitFrameRate(Uint64 now);
+        void recordFrameTime(double frame_time_ms);   ///< @brief 把一帧的帧时间加入滚动窗口和直方图
+        /// @brief 获取直方图中排在第 rank 位（从0开始，升序）的帧时间所在区间的中点（毫秒）
+        double getHistogramValue(size_t rank) const;
     };
 
 } // namespace engine::core
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include "../core/config.h"
 #include <stdexcept>
 #include <SDL3/SDL.h>
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 #include <glm/vec2.hpp>
 
@@ -18,7 +19,7 @@ namespace engine::input {
         float x, y;
         SDL_GetMouseState(&x, &y);
         mouse_position_ = { x, y };
-        spdlog::trace("初始鼠标位置: ({}, {})", mouse_position_.x, mouse_position_.y);
+        ENGINE_LOG_TRACE("初始鼠标位置: ({}, {})", mouse_position_.x, mouse_position_.y);
     }
 
     // --- 更新和事件处理 ---
@@ -34,6 +35,9 @@ namespace engine::input {
             }
         }
 
+        render_targets_reset_ = false;
+        render_device_reset_ = false;
+
         // 2. 处理所有待处理的 SDL 事件 (这将设定 action_states_ 的值)
         SDL_Event event;
         while (SDL_PollEvent(&event)) {
@@ -80,6 +84,15 @@ namespace engine::input {
         case SDL_EVENT_QUIT:
             should_quit_ = true;
             break;
+        case SDL_EVENT_RENDER_TARGETS_RESET:    // 渲染目标纹理的内容丢失（例如 D3D 设备丢失后恢复）
+            render_targets_reset_ = true;
+            spdlog::warn("渲染目标已重置，烘焙的纹理需要重新绘制。");
+            break;
+        case SDL_EVENT_RENDER_DEVICE_RESET:     // 渲染设备重置，所有纹理都需要重新创建
+            render_targets_reset_ = true;
+            render_device_reset_ = true;
+            spdlog::warn("渲染设备已重置，烘焙的纹理需要重新创建。");
+            break;
         default:
             break;
         }
@@ -134,7 +147,7 @@ namespace engine::input {
     // --- 初始化输入映射 ---
 
     void InputManager::initializeMappings(const engine::core::Config* config) {
-        spdlog::trace("初始化输入映射...");
+        ENGINE_LOG_TRACE("初始化输入映射...");
         if (!config) {
             spdlog::error("输入管理器: Config 为空指针");
             throw std::runtime_error("输入管理器: Config 为空指针");
@@ -145,18 +158,18 @@ namespace engine::input {
 
         // 如果配置中没有定义鼠标按钮动作(通常不需要配置),则添加默认映射, 用于 UI
         if (actions_to_keyname_map_.find("MouseLeftClick") == actions_to_keyname_map_.end()) {
-            spdlog::debug("配置中没有定义 'MouseLeftClick' 动作,添加默认映射到 'MouseLeft'.");
+            ENGINE_LOG_DEBUG("配置中没有定义 'MouseLeftClick' 动作,添加默认映射到 'MouseLeft'.");
             actions_to_keyname_map_["MouseLeftClick"] = { "MouseLeft" };     // 如果缺失则添加默认映射
         }
         if (actions_to_keyname_map_.find("MouseRightClick") == actions_to_keyname_map_.end()) {
-            spdlog::debug("配置中没有定义 'MouseRightClick' 动作,添加默认映射到 'MouseRight'.");
+            ENGINE_LOG_DEBUG("配置中没有定义 'MouseRightClick' 动作,添加默认映射到 'MouseRight'.");
             actions_to_keyname_map_["MouseRightClick"] = { "MouseRight" };   // 如果缺失则添加默认映射
         }
         // 遍历 动作 -> 按键名称 的映射
         for (const auto& [action_name, key_names] : actions_to_keyname_map_) {
             // 每个动作对应一个动作状态，初始化为 INACTIVE
             action_states_[action_name] = ActionState::INACTIVE;
-            spdlog::trace("映射动作: {}", action_name);
+            ENGINE_LOG_TRACE("映射动作: {}", action_name);
             // 设置 "按键 -> 动作" 的映射
             for (const std::string& key_name : key_names) {
                 SDL_Scancode scancode = scancodeFromString(key_name);       // 尝试根据按键名称获取scancode
@@ -165,11 +178,11 @@ namespace engine::input {
 
                 if (scancode != SDL_SCANCODE_UNKNOWN) {      // 如果scancode有效,则将action添加到scancode_to_actions_map_中
                     input_to_actions_map_[scancode].push_back(action_name);
-                    spdlog::trace("  映射按键: {} (Scancode: {}) 到动作: {}", key_name, static_cast<int>(scancode), action_name);
+                    ENGINE_LOG_TRACE("  映射按键: {} (Scancode: {}) 到动作: {}", key_name, static_cast<int>(scancode), action_name);
                 }
                 else if (mouse_button != 0) {             // 如果鼠标按钮有效,则将action添加到mouse_button_to_actions_map_中
                     input_to_actions_map_[mouse_button].push_back(action_name);
-                    spdlog::trace("  映射鼠标按钮: {} (Button ID: {}) 到动作: {}", key_name, static_cast<int>(mouse_button), action_name);
+                    ENGINE_LOG_TRACE("  映射鼠标按钮: {} (Button ID: {}) 到动作: {}", key_name, static_cast<int>(mouse_button), action_name);
                     // else if: 未来可添加其它输入类型 ...
                 }
                 else {
@@ -177,7 +190,7 @@ namespace engine::input {
                 }
             }
         }
-        spdlog::trace("输入映射初始化完成.");
+        ENGINE_LOG_TRACE("输入映射初始化完成.");
     }
 
     // --- 工具函数 ---
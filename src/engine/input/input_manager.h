@@ -34,6 +34,8 @@ namespace engine::input {
         std::unordered_map<std::string, ActionState> action_states_;    ///< @brief 存储每个动作的当前状态
 
         bool should_quit_ = false;                                      ///< @brief 退出标志
+        bool render_targets_reset_ = false;                             ///< @brief 本帧渲染目标纹理内容已丢失 (SDL_EVENT_RENDER_TARGETS_RESET / DEVICE_RESET)
+        bool render_device_reset_ = false;                              ///< @brief 本帧渲染设备已重置，所有纹理需要重新创建 (SDL_EVENT_RENDER_DEVICE_RESET)
         glm::vec2 mouse_position_;                                      ///< @brief 鼠标位置 (针对屏幕坐标)
 
     public:
@@ -55,6 +57,8 @@ namespace engine::input {
 
         bool shouldQuit() const;                                         ///< @brief 查询退出状态
         void setShouldQuit(bool should_quit);                            ///< @brief 设置退出状态
+        bool isRenderTargetsReset() const { return render_targets_reset_; } ///< @brief 本帧渲染目标纹理的内容是否已丢失（设备重置时也为 true）
+        bool isRenderDeviceReset() const { return render_device_reset_; }   ///< @brief 本帧渲染设备是否已重置（纹理本身也需要重新创建）
 
         glm::vec2 getMousePosition() const;                              ///< @brief 获取鼠标位置 （屏幕坐标）
         glm::vec2 getLogicalMousePosition() const;                       ///< @brief 获取鼠标位置 （逻辑坐标）
@@ -0,0 +1,112 @@
+#include "component_registry.h"
+#include "game_object.h"
+#include "../component/component.h"
+#include <algorithm>
+#include <bit>
+#include "../core/log.h"
+#include <spdlog/spdlog.h>
+
+namespace engine::object {
+
+    void ComponentRegistry::registerType(engine::component::ComponentTypeId type_id, ComponentPhase phases) {
+        if (type_id >= engine::component::MAX_COMPONENT_TYPES) {
+            spdlog::error("ComponentRegistry: 组件类型编号 {} 超出上限，无法登记。", type_id);
+            return;
+        }
+        if (has_components_) {
+            spdlog::error("ComponentRegistry: 已有组件加入后不能再登记组件类型 {}。", type_id);
+            return;
+        }
+        const std::uint32_t bit = 1u << type_id;
+        if (registered_mask_ & bit) {
+            spdlog::warn("ComponentRegistry: 组件类型 {} 已登记，忽略重复登记。", type_id);
+            return;
+        }
+        registered_mask_ |= bit;
+        phases_[type_id] = phases;
+
+        // 登记后 GameObject 不再逐个调用它的 handleInput / update；render 只跳过未声明 RENDER 的类型
+        skip_input_mask_ |= bit;
+        skip_update_mask_ |= bit;
+        if (!hasPhase(phases, ComponentPhase::RENDER)) skip_render_mask_ |= bit;
+
+        if (hasPhase(phases, ComponentPhase::INPUT)) input_systems_.push_back(type_id);
+        if (hasPhase(phases, ComponentPhase::UPDATE)) update_systems_.push_back(type_id);
+        ENGINE_LOG_TRACE("ComponentRegistry: 登记组件类型 {}，阶段 {}", type_id, static_cast<int>(phases));
+    }
+
+    bool ComponentRegistry::isPooled(engine::component::ComponentTypeId type_id) const {
+        return type_id < engine::component::MAX_COMPONENT_TYPES &&
+            (hasPhase(phases_[type_id], ComponentPhase::INPUT) || hasPhase(phases_[type_id], ComponentPhase::UPDATE));
+    }
+
+    void ComponentRegistry::compactPools() {
+        for (std::uint32_t mask = dirty_mask_; mask != 0; mask &= mask - 1) {
+            auto& pool = pools_[std::countr_zero(mask)];
+            std::erase(pool, nullptr);      // 保持其余组件的顺序（即对象加入场景的顺序）
+            for (size_t i = 0; i < pool.size(); ++i) {
+                pool[i]->registry_slot_ = i;
+            }
+        }
+        dirty_mask_ = 0;
+    }
+
+    void ComponentRegistry::handleInput(engine::core::Context& context) {
+        compactPools();
+        for (auto type_id : input_systems_) {
+            // 按下标遍历：回调中可能添加组件（追加到末尾）或移除组件（只置空，不移动其余元素）
+            auto& pool = pools_[type_id];
+            for (size_t i = 0; i < pool.size(); ++i) {
+                auto* component = pool[i];
+                if (!component) continue;
+                if (component->owner_ && component->owner_->isNeedRemove()) continue;   // 即将被移除的对象不再处理
+                component->handleInput(context);
+            }
+        }
+    }
+
+    void ComponentRegistry::update(float delta_time, engine::core::Context& context) {
+        compactPools();
+        for (auto type_id : update_systems_) {
+            auto& pool = pools_[type_id];
+            for (size_t i = 0; i < pool.size(); ++i) {
+                auto* component = pool[i];
+                if (!component) continue;
+                if (component->owner_ && component->owner_->isNeedRemove()) continue;
+                component->update(delta_time, context);
+            }
+        }
+    }
+
+    void ComponentRegistry::clear() {
+        for (auto& pool : pools_) {
+            pool.clear();
+        }
+        dirty_mask_ = 0;
+        has_components_ = false;
+    }
+
+    void ComponentRegistry::addComponent(engine::component::ComponentTypeId type_id, engine::component::Component* component) {
+        has_components_ = true;
+        if (!component || !isPooled(type_id)) return;
+        component->registry_slot_ = pools_[type_id].size();
+        pools_[type_id].push_back(component);
+    }
+
+    void ComponentRegistry::removeComponent(engine::component::ComponentTypeId type_id, engine::component::Component* component) {
+        if (!component || !isPooled(type_id)) return;
+        // 组件记录着自己的下标，只需置空，O(1)；空位在下一次系统遍历前统一压缩（大量对象同时移除时整体线性）
+        auto& pool = pools_[type_id];
+        auto slot = component->registry_slot_;
+        if (slot >= pool.size() || pool[slot] != component) return;
+        pool[slot] = nullptr;
+        component->registry_slot_ = static_cast<std::size_t>(-1);
+        dirty_mask_ |= 1u << type_id;
+    }
+
+    size_t ComponentRegistry::getComponentCount(engine::component::ComponentTypeId type_id) const {
+        const auto& pool = pools_[type_id];
+        return pool.size() - static_cast<size_t>(std::count(pool.begin(), pool.end(), nullptr));
+    }
+
+} // namespace engine::object
@@ -0,0 +1,97 @@
+#pragma once
+#include "../component/component_type_id.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace engine::core {
+    class Context;
+}
+
+namespace engine::component {
+    class Component;
+}
+
+namespace engine::object {
+
+    /**
+     * @brief 组件参与的循环阶段 (位标志，可组合)
+     */
+    enum class ComponentPhase : std::uint8_t {
+        NONE = 0,
+        INPUT = 1 << 0,     ///< @brief handleInput
+        UPDATE = 1 << 1,    ///< @brief update
+        RENDER = 1 << 2,    ///< @brief render
+    };
+
+    constexpr ComponentPhase operator|(ComponentPhase a, ComponentPhase b) {
+        return static_cast<ComponentPhase>(static_cast<std::uint8_t>(a) | static_cast<std::uint8_t>(b));
+    }
+    constexpr bool hasPhase(ComponentPhase phases, ComponentPhase phase) {
+        return (static_cast<std::uint8_t>(phases) & static_cast<std::uint8_t>(phase)) != 0;
+    }
+
+    /**
+     * @brief 组件系统注册表（可选）：按组件类型集中驱动 handleInput / update。
+     *
+     * 场景通过 registerSystem<T>(phases) 登记组件类型及其真正需要的阶段：
+     * - INPUT / UPDATE：每个类型的组件指针存放在各自的连续数组中，由注册表按系统注册顺序逐类型遍历；
+     * - RENDER：为保持对象之间的绘制顺序，渲染仍由 GameObject 逐对象进行，但未声明 RENDER 的类型会被跳过。
+     * 已登记类型的组件不再由 GameObject 在 handleInput / update 中调用，未声明的阶段则完全不会被访问。
+     * 未登记的类型保持原有行为（由 GameObject 逐个调用）。
+     */
+    class ComponentRegistry final {
+    private:
+        static_assert(engine::component::MAX_COMPONENT_TYPES <= 32, "跳过掩码使用 32 位整数");
+
+        /// @brief 每个组件类型一个连续的指针数组 (只为声明了 INPUT / UPDATE 的类型填充)
+        std::array<std::vector<engine::component::Component*>, engine::component::MAX_COMPONENT_TYPES> pools_;
+        std::array<ComponentPhase, engine::component::MAX_COMPONENT_TYPES> phases_{};   ///< @brief 每个类型声明的阶段
+        std::vector<engine::component::ComponentTypeId> input_systems_;    ///< @brief 参与 INPUT 的类型，按注册顺序
+        std::vector<engine::component::ComponentTypeId> update_systems_;   ///< @brief 参与 UPDATE 的类型，按注册顺序
+        std::uint32_t registered_mask_ = 0;         ///< @brief 已登记的类型
+        std::uint32_t skip_input_mask_ = 0;         ///< @brief GameObject::handleInput 应跳过的类型
+        std::uint32_t skip_update_mask_ = 0;        ///< @brief GameObject::update 应跳过的类型
+        std::uint32_t skip_render_mask_ = 0;        ///< @brief GameObject::render 应跳过的类型
+        std::uint32_t dirty_mask_ = 0;              ///< @brief 数组中有空位（已移除的组件）、需要压缩的类型
+        bool has_components_ = false;               ///< @brief 是否已有组件加入（此后不允许再登记系统）
+
+    public:
+        ComponentRegistry() = default;
+
+        // 禁止拷贝和移动（GameObject 持有指向它的指针）
+        ComponentRegistry(const ComponentRegistry&) = delete;
+        ComponentRegistry& operator=(const ComponentRegistry&) = delete;
+        ComponentRegistry(ComponentRegistry&&) = delete;
+        ComponentRegistry& operator=(ComponentRegistry&&) = delete;
+
+        /**
+         * @brief 登记组件类型 T 及其需要的阶段。系统按登记顺序执行。
+         * @note 必须在向场景添加对象之前调用（已存在的组件无法补充登记），否则登记失败并输出错误。
+         */
+        template <typename T>
+        void registerSystem(ComponentPhase phases) {
+            registerType(engine::component::getComponentTypeId<T>(), phases);
+        }
+
+        void handleInput(engine::core::Context& context);                  ///< @brief 按注册顺序执行所有 INPUT 系统
+        void update(float delta_time, engine::core::Context& context);     ///< @brief 按注册顺序执行所有 UPDATE 系统
+        void clear();                                                       ///< @brief 清空所有组件数组（保留系统登记）
+
+        // --- 供 GameObject 使用 ---
+        void addComponent(engine::component::ComponentTypeId type_id, engine::component::Component* component);     ///< @brief 组件加入对应数组
+        void removeComponent(engine::component::ComponentTypeId type_id, engine::component::Component* component);  ///< @brief 组件移出对应数组
+        bool skipsInput(engine::component::ComponentTypeId type_id) const { return (skip_input_mask_ >> type_id) & 1u; }    ///< @brief GameObject 是否跳过该类型的 handleInput
+        bool skipsUpdate(engine::component::ComponentTypeId type_id) const { return (skip_update_mask_ >> type_id) & 1u; }  ///< @brief GameObject 是否跳过该类型的 update
+        bool skipsRender(engine::component::ComponentTypeId type_id) const { return (skip_render_mask_ >> type_id) & 1u; }  ///< @brief GameObject 是否跳过该类型的 render
+
+        size_t getComponentCount(engine::component::ComponentTypeId type_id) const;    ///< @brief 获取某类型数组中的组件数量（不含已移除的空位）
+
+    private:
+        void registerType(engine::component::ComponentTypeId type_id, ComponentPhase phases);
+        bool isPooled(engine::component::ComponentTypeId type_id) const;   ///< @brief 该类型是否需要放入数组（已登记且声明了 INPUT / UPDATE）
+        /// @brief 压缩有空位的数组：一次稳定压缩去掉所有空位并更新组件下标，O(n)。在系统遍历之前调用，遍历期间数组不会移动
+        void compactPools();
+    };
+
+} // namespace engine::object
@@ -1,44 +1,108 @@
 #include "game_object.h"
+#include "component_registry.h"
 #include "../render/renderer.h"
 #include "../input/input_manager.h" 
 #include "../render/camera.h"
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::object {
     GameObject::GameObject(const std::string& name, const std::string& tag) : name_(name), tag_(tag)
     {
-        spdlog::trace("GameObject created: {} {}", name_, tag_);
+        component_slots_.fill(NO_COMPONENT);
+        ENGINE_LOG_TRACE("GameObject created: {} {}", name_, tag_);
     }
 
     void GameObject::update(float delta_time, engine::core::Context& context) {
         // 遍历所有组件并调用它们的 update 方法
-        for (auto& pair : components_) {
-            pair.second->update(delta_time, context);
+        // 按下标遍历：组件在回调中添加组件时 vector 可能重新分配（其它遍历同理）
+        // 已登记到组件系统的类型由 ComponentRegistry 集中更新，这里跳过
+        for (size_t i = 0; i < components_.size(); ++i) {
+            if (registry_ && registry_->skipsUpdate(component_type_ids_[i])) continue;
+            components_[i]->update(delta_time, context);
         }
     }
 
     void GameObject::render(engine::core::Context& context) {
         // 遍历所有组件并调用它们的 render 方法
-        for (auto& pair : components_) {
-            pair.second->render(context);
+        for (size_t i = 0; i < components_.size(); ++i) {
+            if (registry_ && registry_->skipsRender(component_type_ids_[i])) continue;
+            components_[i]->render(context);
         }
     }
 
     void GameObject::clean() {
-        spdlog::trace("Cleaning GameObject...");
+        ENGINE_LOG_TRACE("Cleaning GameObject...");
         // 遍历所有组件并调用它们的 clean 方法
-        for (auto& pair : components_) {
-            pair.second->clean();
+        for (size_t i = 0; i < components_.size(); ++i) {
+            if (registry_) registry_->removeComponent(component_type_ids_[i], components_[i].get());
+            components_[i]->clean();
         }
-        components_.clear(); // 清空 map, unique_ptr 会自动释放内存
+        components_.clear(); // 清空列表, unique_ptr 会自动释放内存
+        component_type_ids_.clear();
+        component_slots_.fill(NO_COMPONENT);
+        registry_ = nullptr;
     }
 
     void GameObject::handleInput(engine::core::Context& context) {
         // 遍历所有组件并调用它们的 handleInput 方法
-        for (auto& pair : components_) {
-            pair.second->handleInput(context);
+        for (size_t i = 0; i < components_.size(); ++i) {
+            if (registry_ && registry_->skipsInput(component_type_ids_[i])) continue;
+            components_[i]->handleInput(context);
         }
     }
 
+    void GameObject::notifyComponentsChanged() {
+        for (size_t i = 0; i < components_.size(); ++i) {
+            components_[i]->onComponentsChanged();
+        }
+    }
+
+    void GameObject::releaseToPool() {
+        if (in_pool_) return;
+        attachRegistry(nullptr);
+        for (auto& component : components_) {
+            component->onRelease();
+        }
+        in_pool_ = true;
+    }
+
+    void GameObject::acquireFromPool() {
+        need_remove_ = false;
+        in_pool_ = false;
+        for (auto& component : components_) {
+            component->onAcquire();
+        }
+    }
+
+    void GameObject::attachRegistry(ComponentRegistry* registry) {
+        if (registry_ == registry) return;
+        for (size_t i = 0; i < components_.size(); ++i) {
+            if (registry_) registry_->removeComponent(component_type_ids_[i], components_[i].get());
+            if (registry) registry->addComponent(component_type_ids_[i], components_[i].get());
+        }
+        registry_ = registry;
+    }
+
+    void GameObject::insertComponent(engine::component::ComponentTypeId type_id, std::unique_ptr<engine::component::Component> component) {
+        if (registry_) registry_->addComponent(type_id, component.get());
+        component_slots_[type_id] = static_cast<std::uint8_t>(components_.size());
+        component_type_ids_.push_back(type_id);
+        components_.push_back(std::move(component));
+    }
+
+    void GameObject::removeSlot(engine::component::ComponentTypeId type_id) {
+        auto slot = component_slots_[type_id];
+        if (registry_) registry_->removeComponent(type_id, components_[slot].get());
+        components_.erase(components_.begin() + slot);
+        component_type_ids_.erase(component_type_ids_.begin() + slot);
+        component_slots_[type_id] = NO_COMPONENT;
+        // 后面的组件前移了一位
+        for (auto& other : component_slots_) {
+            if (other != NO_COMPONENT && other > slot) {
+                --other;
+            }
+        }
+    }
 
 } // namespace engine::object 
\ No newline at end of file
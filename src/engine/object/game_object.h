@@ -1,29 +1,53 @@
 #pragma once
 #include "../component/component.h" 
+#include "../component/component_type_id.h"
+#include "../render/render_layer.h"
+#include <array>
 #include <memory>
-#include <unordered_map>
-#include <typeindex>        // 用于类型索引
+#include <vector>
+#include <typeinfo>         // 用于日志中的类型名
 #include <utility>          // 用于完美转发
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::core {
     class Context;
 }
 
+namespace engine::scene {
+    class Scene;
+}
+
 namespace engine::object {
+    class ComponentRegistry;
 
     /**
      * @brief 游戏对象类，负责管理游戏对象的组件。
      *
      * 该类管理游戏对象的组件，并提供添加、获取、检查和移除组件的功能。
      * 它还提供更新和渲染游戏对象的方法。
+     *
+     * 组件按添加顺序紧凑存放在 components_ 中（遍历顺序确定），
+     * component_slots_ 以组件类型编号为下标记录组件所在位置，getComponent 只需两次数组访问。
+     * 加入场景后会关联场景的 ComponentRegistry，由其集中驱动已登记类型的组件。
+     * 渲染层 (setRenderLayer) 决定对象之间的绘制先后，同一层内的精灵在批处理时按纹理合并。
      */
     class GameObject final {
     private:
         std::string name_;          ///< @brief 名称
         std::string tag_;           ///< @brief 标签
-        std::unordered_map<std::type_index, std::unique_ptr<engine::component::Component>> components_;  ///< @brief 组件列表
+        static constexpr std::uint8_t NO_COMPONENT = 0xFF;     ///< @brief component_slots_ 中表示"没有该类型组件"
+
+        std::vector<std::unique_ptr<engine::component::Component>> components_;  ///< @brief 组件列表（按添加顺序）
+        /// @brief 组件类型编号 -> components_ 下标 (NO_COMPONENT 表示不存在)
+        std::array<std::uint8_t, engine::component::MAX_COMPONENT_TYPES> component_slots_;
+        std::vector<engine::component::ComponentTypeId> component_type_ids_;    ///< @brief 与 components_ 一一对应的组件类型编号
+        ComponentRegistry* registry_ = nullptr;     ///< @brief 关联的组件系统注册表（非拥有，可为空）
+        engine::scene::Scene* scene_ = nullptr;     ///< @brief 所在的场景（非拥有，未加入场景或已被移除时为空）
+        int render_layer_ = static_cast<int>(engine::render::RenderLayer::ACTORS);   ///< @brief 渲染层（见 RenderLayer，默认为角色层）
         bool need_remove_ = false;  ///< @brief 延迟删除的标识，将来由场景类负责删除
+        std::string prefab_name_;   ///< @brief 所属对象池的预制体名称（为空表示不使用对象池）
+        bool in_pool_ = false;      ///< @brief 是否已被回收到对象池（闲置中）
 
     public:
 
@@ -42,6 +66,22 @@ namespace engine::object {
         const std::string& getTag() const { return tag_; }                      ///< @brief 获取标签
         void setNeedRemove(bool need_remove) { need_remove_ = need_remove; }    ///< @brief 设置是否需要删除
         bool isNeedRemove() const { return need_remove_; }                      ///< @brief 获取是否需要删除
+        void setPrefabName(const std::string& prefab_name) { prefab_name_ = prefab_name; }  ///< @brief 设置所属对象池的预制体名称
+        const std::string& getPrefabName() const { return prefab_name_; }       ///< @brief 获取所属对象池的预制体名称
+        bool isInPool() const { return in_pool_; }                              ///< @brief 是否闲置在对象池中
+        void setScene(engine::scene::Scene* scene) { scene_ = scene; }          ///< @brief 设置所在的场景（由 Scene 在对象加入/移除时调用）
+        engine::scene::Scene* getScene() const { return scene_; }               ///< @brief 获取所在的场景
+        /// @brief 设置渲染层，order 为层内的细分序号（值大的后绘制）
+        void setRenderLayer(engine::render::RenderLayer layer, int order = 0) { render_layer_ = static_cast<int>(layer) + order; }
+        int getRenderLayer() const { return render_layer_; }                    ///< @brief 获取渲染层（RenderLayer 基值 + 层内序号）
+
+        /// @brief 回收到对象池：断开组件系统，并通知所有组件 onRelease。组件保留以便复用（重复调用无效果）
+        void releaseToPool();
+        /// @brief 从对象池取出：清除删除标记，并通知所有组件 onAcquire 恢复初始状态
+        void acquireFromPool();
+
+        /// @brief 关联组件系统注册表，并登记已有的组件（由 Scene 在对象加入时调用）
+        void attachRegistry(ComponentRegistry* registry);
 
         /**
          * @brief 添加组件 (里面会完成组件的init())
@@ -56,9 +96,12 @@ namespace engine::object {
             // 检测组件是否合法。  /*  static_assert(condition, message)：静态断言，在编译期检测，无任何性能影响 */
                                 /* std::is_base_of<Base, Derived>::value -- 判断 Base 类型是否是 Derived 类型的基类 */
             static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-            // 获取类型标识。     /* typeid(T) -- 用于获取一个表达式或类型的运行时类型信息 (RTTI), 返回 std::type_info& */
-                                /* std::type_index -- 针对std::type_info对象的包装器，主要设计用来作为关联容器（如 std::map）的键。*/
-            auto type_index = std::type_index(typeid(T));
+            // 获取类型编号 (每个组件类型一个从0开始的紧凑编号)
+            auto type_id = engine::component::getComponentTypeId<T>();
+            if (type_id >= engine::component::MAX_COMPONENT_TYPES) {
+                spdlog::error("GameObject::addComponent: 组件类型数量超过上限 {}，无法添加 {}", engine::component::MAX_COMPONENT_TYPES, typeid(T).name());
+                return nullptr;
+            }
             // 如果组件已经存在，则直接返回组件指针
             if (hasComponent<T>()) {
                 return getComponent<T>();
@@ -67,9 +110,10 @@ namespace engine::object {
             auto new_component = std::make_unique<T>(std::forward<Args>(args)...);
             T* ptr = new_component.get();                               // 先获取裸指针以便返回
             new_component->setOwner(this);                              // 设置组件的拥有者
-            components_[type_index] = std::move(new_component);         // 移动组件   （new_component 变为空，不可再使用）
+            insertComponent(type_id, std::move(new_component));         // 存入列表并登记到组件系统 （new_component 变为空，不可再使用）
             ptr->init();                                                // 初始化组件 （因此必须用ptr而不能用new_component）
-            spdlog::debug("GameObject::addComponent: {} added component {}", name_, typeid(T).name());
+            notifyComponentsChanged();                                  // 通知其它组件刷新缓存的组件指针
+            ENGINE_LOG_DEBUG("GameObject::addComponent: {} added component {}", name_, typeid(T).name());
             return ptr;                                                 // 返回非拥有指针
         }
 
@@ -82,11 +126,10 @@ namespace engine::object {
         template <typename T>
         T* getComponent() const {
             static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-            auto type_index = std::type_index(typeid(T));
-            auto it = components_.find(type_index);
-            if (it != components_.end()) {
+            auto slot = findSlot(engine::component::getComponentTypeId<T>());
+            if (slot != NO_COMPONENT) {
                 // 返回unique_ptr的裸指针。(肯定是T类型, static_cast其实并无必要，但保留可以使我们意图更清晰)
-                return static_cast<T*>(it->second.get());
+                return static_cast<T*>(components_[slot].get());
             }
             return nullptr;
         }
@@ -100,8 +143,7 @@ namespace engine::object {
         template <typename T>
         bool hasComponent() const {
             static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-            // contains方法为 C++20 新增
-            return components_.contains(std::type_index(typeid(T)));
+            return findSlot(engine::component::getComponentTypeId<T>()) != NO_COMPONENT;
         }
 
         /**
@@ -112,11 +154,12 @@ namespace engine::object {
         template <typename T>
         void removeComponent() {
             static_assert(std::is_base_of<engine::component::Component, T>::value, "T 必须继承自 Component");
-            auto type_index = std::type_index(typeid(T));
-            auto it = components_.find(type_index);
-            if (it != components_.end()) {
-                it->second->clean();
-                components_.erase(it);
+            auto type_id = engine::component::getComponentTypeId<T>();
+            auto slot = findSlot(type_id);
+            if (slot != NO_COMPONENT) {
+                components_[slot]->clean();
+                removeSlot(type_id);
+                notifyComponentsChanged();
             }
         }
 
@@ -126,6 +169,15 @@ namespace engine::object {
         void clean();                                                               ///< @brief 清理所有组件
         void handleInput(engine::core::Context& context);                           ///< @brief 处理输入
 
+    private:
+        void notifyComponentsChanged();     ///< @brief 组件增删后通知所有组件 (调用 Component::onComponentsChanged)
+        /// @brief 查找类型编号对应的组件下标，不存在返回 NO_COMPONENT
+        std::uint8_t findSlot(engine::component::ComponentTypeId type_id) const {
+            return type_id < component_slots_.size() ? component_slots_[type_id] : NO_COMPONENT;
+        }
+        /// @brief 把组件加入列表末尾，记录其类型编号，并登记到关联的组件系统
+        void insertComponent(engine::component::ComponentTypeId type_id, std::unique_ptr<engine::component::Component> component);
+        void removeSlot(engine::component::ComponentTypeId type_id);    ///< @brief 删除该类型的组件，后面的组件前移（保持添加顺序）
     };
 
 } // namespace engine::object
\ No newline at end of file
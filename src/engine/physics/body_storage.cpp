@@ -0,0 +1,129 @@
+#include "body_storage.h"
+#include <algorithm>
+#include <glm/common.hpp>
+
+// 选择积分内核的实现：AVX2 > SSE2 > 标量
+#if defined(ENGINE_PHYSICS_NO_SIMD)
+    // 强制使用标量实现
+#elif defined(__AVX2__)
+    #include <immintrin.h>
+    #define ENGINE_PHYSICS_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #include <emmintrin.h>
+    #define ENGINE_PHYSICS_SSE2
+#endif
+
+namespace engine::physics {
+
+    std::size_t BodyStorage::add(float mass, bool use_gravity, bool enabled) {
+        velocity_x_.push_back(0.0f);
+        velocity_y_.push_back(0.0f);
+        force_x_.push_back(0.0f);
+        force_y_.push_back(0.0f);
+        inverse_mass_.push_back(mass > 0.0f ? 1.0f / mass : 0.0f);
+        flags_.push_back((enabled ? FLAG_ENABLED : 0u) | (use_gravity ? FLAG_GRAVITY : 0u));
+        return flags_.size() - 1;
+    }
+
+    void BodyStorage::swapRemove(std::size_t index) {
+        if (index >= flags_.size()) return;
+        auto swap_pop = [index](auto& array) {
+            array[index] = array.back();
+            array.pop_back();
+        };
+        swap_pop(velocity_x_);
+        swap_pop(velocity_y_);
+        swap_pop(force_x_);
+        swap_pop(force_y_);
+        swap_pop(inverse_mass_);
+        swap_pop(flags_);
+    }
+
+    void BodyStorage::integrate(const glm::vec2& gravity, float max_speed, float delta_time) {
+        const std::size_t count = flags_.size();
+        std::size_t i = 0;
+
+#if defined(ENGINE_PHYSICS_AVX2)
+        // 每次处理 8 个刚体
+        const __m256 dt = _mm256_set1_ps(delta_time);
+        const __m256 gx = _mm256_set1_ps(gravity.x);
+        const __m256 gy = _mm256_set1_ps(gravity.y);
+        const __m256 max_v = _mm256_set1_ps(max_speed);
+        const __m256 min_v = _mm256_set1_ps(-max_speed);
+        const __m256i active_mask = _mm256_set1_epi32(static_cast<int>(FLAG_ENABLED | FLAG_SLEEPING));
+        const __m256i enabled_bit = _mm256_set1_epi32(static_cast<int>(FLAG_ENABLED));
+        const __m256i gravity_bit = _mm256_set1_epi32(static_cast<int>(FLAG_GRAVITY));
+        for (; i + 8 <= count; i += 8) {
+            // 根据标志位生成掩码（全1 或 全0），只有"启用且未休眠"的刚体参与积分
+            const __m256i flags = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(flags_.data() + i));
+            const __m256 enabled = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(flags, active_mask), enabled_bit));
+            const __m256 use_gravity = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(flags, gravity_bit), gravity_bit));
+
+            // a = F / m + g
+            const __m256 inv_mass = _mm256_loadu_ps(inverse_mass_.data() + i);
+            const __m256 fx = _mm256_loadu_ps(force_x_.data() + i);
+            const __m256 fy = _mm256_loadu_ps(force_y_.data() + i);
+            const __m256 ax = _mm256_add_ps(_mm256_mul_ps(fx, inv_mass), _mm256_and_ps(use_gravity, gx));
+            const __m256 ay = _mm256_add_ps(_mm256_mul_ps(fy, inv_mass), _mm256_and_ps(use_gravity, gy));
+
+            // v = clamp(v + a * dt, -max, max)，未启用的刚体保持原值
+            const __m256 vx = _mm256_loadu_ps(velocity_x_.data() + i);
+            const __m256 vy = _mm256_loadu_ps(velocity_y_.data() + i);
+            const __m256 new_vx = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(vx, _mm256_mul_ps(ax, dt)), min_v), max_v);
+            const __m256 new_vy = _mm256_min_ps(_mm256_max_ps(_mm256_add_ps(vy, _mm256_mul_ps(ay, dt)), min_v), max_v);
+            _mm256_storeu_ps(velocity_x_.data() + i, _mm256_blendv_ps(vx, new_vx, enabled));
+            _mm256_storeu_ps(velocity_y_.data() + i, _mm256_blendv_ps(vy, new_vy, enabled));
+        }
+#elif defined(ENGINE_PHYSICS_SSE2)
+        // 每次处理 4 个刚体 (SSE2 没有 blendv，使用 and/andnot/or 进行选择)
+        const __m128 dt = _mm_set1_ps(delta_time);
+        const __m128 gx = _mm_set1_ps(gravity.x);
+        const __m128 gy = _mm_set1_ps(gravity.y);
+        const __m128 max_v = _mm_set1_ps(max_speed);
+        const __m128 min_v = _mm_set1_ps(-max_speed);
+        const __m128i active_mask = _mm_set1_epi32(static_cast<int>(FLAG_ENABLED | FLAG_SLEEPING));
+        const __m128i enabled_bit = _mm_set1_epi32(static_cast<int>(FLAG_ENABLED));
+        const __m128i gravity_bit = _mm_set1_epi32(static_cast<int>(FLAG_GRAVITY));
+        for (; i + 4 <= count; i += 4) {
+            const __m128i flags = _mm_loadu_si128(reinterpret_cast<const __m128i*>(flags_.data() + i));
+            const __m128 enabled = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(flags, active_mask), enabled_bit));
+            const __m128 use_gravity = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(flags, gravity_bit), gravity_bit));
+
+            const __m128 inv_mass = _mm_loadu_ps(inverse_mass_.data() + i);
+            const __m128 fx = _mm_loadu_ps(force_x_.data() + i);
+            const __m128 fy = _mm_loadu_ps(force_y_.data() + i);
+            const __m128 ax = _mm_add_ps(_mm_mul_ps(fx, inv_mass), _mm_and_ps(use_gravity, gx));
+            const __m128 ay = _mm_add_ps(_mm_mul_ps(fy, inv_mass), _mm_and_ps(use_gravity, gy));
+
+            const __m128 vx = _mm_loadu_ps(velocity_x_.data() + i);
+            const __m128 vy = _mm_loadu_ps(velocity_y_.data() + i);
+            const __m128 new_vx = _mm_min_ps(_mm_max_ps(_mm_add_ps(vx, _mm_mul_ps(ax, dt)), min_v), max_v);
+            const __m128 new_vy = _mm_min_ps(_mm_max_ps(_mm_add_ps(vy, _mm_mul_ps(ay, dt)), min_v), max_v);
+            _mm_storeu_ps(velocity_x_.data() + i, _mm_or_ps(_mm_and_ps(enabled, new_vx), _mm_andnot_ps(enabled, vx)));
+            _mm_storeu_ps(velocity_y_.data() + i, _mm_or_ps(_mm_and_ps(enabled, new_vy), _mm_andnot_ps(enabled, vy)));
+        }
+#endif
+        // 标量处理剩余部分（或全部）
+        integrateScalar(i, count, gravity, max_speed, delta_time);
+    }
+
+    void BodyStorage::integrateScalar(std::size_t begin, std::size_t end, const glm::vec2& gravity, float max_speed, float delta_time) {
+        for (std::size_t i = begin; i < end; ++i) {
+            if ((flags_[i] & (FLAG_ENABLED | FLAG_SLEEPING)) != FLAG_ENABLED) continue;    // 未启用或休眠中
+            float ax = force_x_[i] * inverse_mass_[i];
+            float ay = force_y_[i] * inverse_mass_[i];
+            if (flags_[i] & FLAG_GRAVITY) {
+                ax += gravity.x;
+                ay += gravity.y;
+            }
+            velocity_x_[i] = glm::clamp(velocity_x_[i] + ax * delta_time, -max_speed, max_speed);
+            velocity_y_[i] = glm::clamp(velocity_y_[i] + ay * delta_time, -max_speed, max_speed);
+        }
+    }
+
+    void BodyStorage::clearForces() {
+        std::fill(force_x_.begin(), force_x_.end(), 0.0f);
+        std::fill(force_y_.begin(), force_y_.end(), 0.0f);
+    }
+
+} // namespace engine::physics
@@ -0,0 +1,79 @@
+#pragma once
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <glm/vec2.hpp>
+
+namespace engine::physics {
+
+    /**
+     * @brief 以"结构数组"(SoA) 方式紧凑存储所有刚体的动力学数据。
+     *
+     * 每个刚体在各个数组中占用同一下标（即句柄），积分时可以连续读写各数组，便于向量化（SSE/AVX2）。
+     * 由 PhysicsEngine 拥有，PhysicsComponent 只保存自己的下标。
+     * @note 位置仍由 TransformComponent 保存（渲染与游戏逻辑都直接读取它），这里只存储速度、力、质量等积分所需数据。
+     */
+    class BodyStorage final {
+    public:
+        static constexpr std::uint32_t FLAG_ENABLED = 1u << 0;      ///< @brief 刚体参与模拟
+        static constexpr std::uint32_t FLAG_GRAVITY = 1u << 1;      ///< @brief 刚体受重力影响
+        static constexpr std::uint32_t FLAG_SLEEPING = 1u << 2;     ///< @brief 刚体处于休眠状态（跳过积分）
+        static constexpr std::size_t INVALID_INDEX = static_cast<std::size_t>(-1);  ///< @brief 无效句柄
+
+    private:
+        std::vector<float> velocity_x_;         ///< @brief 速度 x 分量 (像素/秒)
+        std::vector<float> velocity_y_;         ///< @brief 速度 y 分量 (像素/秒)
+        std::vector<float> force_x_;            ///< @brief 当前帧受到的力 x 分量
+        std::vector<float> force_y_;            ///< @brief 当前帧受到的力 y 分量
+        std::vector<float> inverse_mass_;       ///< @brief 质量的倒数 (质量为0时为0，即不受外力影响)
+        std::vector<std::uint32_t> flags_;      ///< @brief FLAG_ENABLED / FLAG_GRAVITY / FLAG_SLEEPING 组合
+
+    public:
+        BodyStorage() = default;
+
+        // 禁止拷贝和移动（PhysicsComponent 持有指向它的指针）
+        BodyStorage(const BodyStorage&) = delete;
+        BodyStorage& operator=(const BodyStorage&) = delete;
+        BodyStorage(BodyStorage&&) = delete;
+        BodyStorage& operator=(BodyStorage&&) = delete;
+
+        /**
+         * @brief 添加一个刚体，速度和力初始为0。
+         * @return 新刚体的下标（句柄）
+         */
+        std::size_t add(float mass, bool use_gravity, bool enabled);
+
+        /**
+         * @brief 移除指定下标的刚体：将最后一个刚体移到该位置后弹出，O(1)（不保持注册顺序）。
+         * @note 调用者需要负责将原最后一个刚体的句柄更新为 index。
+         */
+        void swapRemove(std::size_t index);
+
+        /**
+         * @brief 积分步骤：对所有启用且未休眠的刚体应用重力和外力，更新速度并限制最大速度。
+         * @note 不清除力：同一帧的多个物理子步使用相同的力，帧结束时由 clearForces 统一清除。
+         *
+         * v += (g + F / m) * dt，v = clamp(v, -max_speed, max_speed)。
+         * 根据编译目标自动选择 AVX2 / SSE2 实现，不支持时使用标量实现（定义 ENGINE_PHYSICS_NO_SIMD 可强制使用标量实现）。
+         */
+        void integrate(const glm::vec2& gravity, float max_speed, float delta_time);
+        void clearForces();                     ///< @brief 清除所有刚体的力
+
+        // --- 访问单个刚体 ---
+        std::size_t size() const { return flags_.size(); }     ///< @brief 刚体数量
+        glm::vec2 getVelocity(std::size_t i) const { return { velocity_x_[i], velocity_y_[i] }; }
+        void setVelocity(std::size_t i, const glm::vec2& v) { velocity_x_[i] = v.x; velocity_y_[i] = v.y; }
+        void setVelocityX(std::size_t i, float vx) { velocity_x_[i] = vx; }
+        void setVelocityY(std::size_t i, float vy) { velocity_y_[i] = vy; }
+        glm::vec2 getForce(std::size_t i) const { return { force_x_[i], force_y_[i] }; }
+        void addForce(std::size_t i, const glm::vec2& f) { force_x_[i] += f.x; force_y_[i] += f.y; }
+        void clearForce(std::size_t i) { force_x_[i] = 0.0f; force_y_[i] = 0.0f; }
+        void setMass(std::size_t i, float mass) { inverse_mass_[i] = mass > 0.0f ? 1.0f / mass : 0.0f; }
+        void setFlag(std::size_t i, std::uint32_t flag, bool value) { flags_[i] = value ? (flags_[i] | flag) : (flags_[i] & ~flag); }
+
+    private:
+        /// @brief 标量实现，处理 [begin, end) 范围内的刚体（SIMD 实现用它处理余下的尾部）
+        void integrateScalar(std::size_t begin, std::size_t end, const glm::vec2& gravity, float max_speed, float delta_time);
+    };
+
+} // namespace engine::physics
@@ -5,116 +5,381 @@
 #include "../component/collider_component.h"
 #include "../component/tilelayer_component.h"
 #include "../object/game_object.h"
-#include <set>
+#include "../core/profiler.h"
+#include <algorithm>
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 #include <glm/common.hpp>
 
 namespace engine::physics {
 
     void PhysicsEngine::registerComponent(engine::component::PhysicsComponent* component) {
-        components_.push_back(component);
-        spdlog::trace("物理组件注册完成。");
+        if (!component) return;
+        bodies_.push_back(makeBody(component));
+        // 在 SoA 存储中分配刚体数据，组件通过下标访问
+        component->body_index_ = body_storage_.add(component->getMass(), component->isUseGravity(), component->isEnabled());
+        component->body_storage_ = &body_storage_;
+        ENGINE_LOG_TRACE("物理组件注册完成。");
     }
 
     void PhysicsEngine::unregisterComponent(engine::component::PhysicsComponent* component) {
-        // 使用 remove-erase 方法安全地移除指针
-        auto it = std::remove(components_.begin(), components_.end(), component);
-        components_.erase(it, components_.end());
-        spdlog::trace("物理组件注销完成。");
+        if (!component) return;
+        // 组件自己记录着下标，无需查找；校验一下以防组件未注册到本引擎
+        auto index = component->body_index_;
+        if (index >= bodies_.size() || bodies_[index].physics != component) return;
+
+        // 将最后一个刚体移到空位（记录与刚体数据同步），只需修正被移动组件的下标，O(1)
+        auto last = bodies_.size() - 1;
+        if (index != last) {
+            bodies_[index] = bodies_[last];
+            bodies_[index].physics->body_index_ = index;
+        }
+        bodies_.pop_back();
+        body_storage_.swapRemove(index);
+        if (auto* tc = component->getTransform(); tc) tc->resetInterpolation();
+        component->body_storage_ = nullptr;
+        component->body_index_ = BodyStorage::INVALID_INDEX;
+        component->sleeping_ = false;
+        component->resting_frames_ = 0;
+        ENGINE_LOG_TRACE("物理组件注销完成。");
+    }
+
+    void PhysicsEngine::refreshComponent(engine::component::PhysicsComponent* component) {
+        if (!component) return;
+        auto index = component->body_index_;
+        if (index >= bodies_.size() || bodies_[index].physics != component) return;
+        bodies_[index] = makeBody(component);
+        ENGINE_LOG_TRACE("物理组件的刚体记录已刷新。");
+    }
+
+    PhysicsBody PhysicsEngine::makeBody(engine::component::PhysicsComponent* component) {
+        PhysicsBody body;
+        body.physics = component;
+        body.owner = component->getOwner();
+        if (body.owner) {
+            body.transform = body.owner->getComponent<engine::component::TransformComponent>();
+            body.collider = body.owner->getComponent<engine::component::ColliderComponent>();
+        }
+        return body;
     }
 
     void PhysicsEngine::registerCollisionLayer(engine::component::TileLayerComponent* layer)
     {
         layer->setPhysicsEngine(this); // 设置物理引擎指针
         collision_tile_layers_.push_back(layer);
-        spdlog::trace("碰撞瓦片图层注册完成。");
+        ENGINE_LOG_TRACE("碰撞瓦片图层注册完成。");
     }
 
     void PhysicsEngine::unregisterCollisionLayer(engine::component::TileLayerComponent* layer) {
         auto it = std::remove(collision_tile_layers_.begin(), collision_tile_layers_.end(), layer);
         collision_tile_layers_.erase(it, collision_tile_layers_.end());
-        spdlog::trace("碰撞瓦片图层注销完成。");
+        ENGINE_LOG_TRACE("碰撞瓦片图层注销完成。");
+    }
+
+    void PhysicsEngine::setFrameResource(std::pmr::memory_resource* resource) {
+        frame_resource_ = resource ? resource : std::pmr::get_default_resource();
+        // 丢弃旧分配器上的内容，之后的 update 会在新分配器上重新创建
+        collision_pairs_ = decltype(collision_pairs_)(frame_resource_);
+        tile_trigger_events_ = decltype(tile_trigger_events_)(frame_resource_);
+    }
+
+    void PhysicsEngine::setFrameCounters(engine::core::FrameCounters* counters) {
+        frame_counters_ = counters;
+        if (!frame_counters_) return;
+        counter_ids_.bodies_integrated = frame_counters_->registerCounter("physics.bodies_integrated");
+        counter_ids_.tile_probes = frame_counters_->registerCounter("physics.tile_probes");
+        counter_ids_.pair_tests = frame_counters_->registerCounter("physics.pair_tests");
+        counter_ids_.solid_resolutions = frame_counters_->registerCounter("physics.solid_resolutions");
     }
 
     void PhysicsEngine::update(float delta_time) {
-        // 每帧开始时先清空碰撞对列表和瓦片触发事件列表
-        collision_pairs_.clear();
-        tile_trigger_events_.clear();
+        ENGINE_PROFILE_SCOPE("PhysicsEngine::update");
+        // 每帧开始时在帧分配器上重新创建碰撞对列表和瓦片触发事件列表 (多个子步的结果汇总到同一列表)
+        // 上一帧的内存已随分配器重置而失效，因此不能 clear 后复用。按上一帧的数量预留，避免逐步扩容
+        auto last_pair_count = collision_pairs_.size();
+        auto last_event_count = tile_trigger_events_.size();
+        collision_pairs_ = decltype(collision_pairs_)(frame_resource_);
+        tile_trigger_events_ = decltype(tile_trigger_events_)(frame_resource_);
+        collision_pairs_.reserve(last_pair_count);
+        tile_trigger_events_.reserve(last_event_count);
+
+        if (!fixed_timestep_) {
+            step(delta_time);
+            body_storage_.clearForces();    // 清除当前帧的力
+            last_substeps_ = 1;
+            interpolation_alpha_ = 1.0f;
+            return;
+        }
 
-        // 遍历所有注册的物理组件
-        for (auto* pc : components_) {
-            if (!pc || !pc->isEnabled()) { // 检查组件是否有效和启用
-                continue;
-            }
+        // 固定步长：累计时间，按固定步长执行子步
+        const float fixed_dt = *fixed_timestep_;
+        accumulator_ += delta_time;
+        last_substeps_ = 0;
+        while (accumulator_ >= fixed_dt && last_substeps_ < max_substeps_) {
+            savePreviousPositions();
+            step(fixed_dt);
+            accumulator_ -= fixed_dt;
+            ++last_substeps_;
+        }
+        if (accumulator_ >= fixed_dt) {
+            // 达到子步上限 (例如长时间卡顿)，丢弃多余的时间，避免下一帧继续追赶
+            ENGINE_LOG_DEBUG("物理更新达到子步上限 {}，丢弃 {:.3f} 秒模拟时间。", max_substeps_, accumulator_ - glm::mod(accumulator_, fixed_dt));
+            accumulator_ = glm::mod(accumulator_, fixed_dt);
+        }
+        interpolation_alpha_ = accumulator_ / fixed_dt;
+        // 游戏逻辑每帧施加的力作用于本帧的所有子步，帧结束时统一清除
+        // (没有执行子步的帧也清除，这样单位时间内力的冲量与帧率无关)
+        body_storage_.clearForces();
+    }
 
-            pc->resetCollisionFlags();  // 重置碰撞标志
+    void PhysicsEngine::setFixedTimestep(float step, int max_substeps)
+    {
+        if (step <= 0.0f) {
+            spdlog::warn("物理固定步长必须为正数: {}，保持原设置。", step);
+            return;
+        }
+        fixed_timestep_ = step;
+        max_substeps_ = max_substeps > 0 ? max_substeps : 1;
+        accumulator_ = 0.0f;
+        spdlog::info("物理引擎使用固定步长: {:.4f} 秒 ({:.0f} Hz)，每帧最多 {} 个子步。", step, 1.0f / step, max_substeps_);
+    }
 
-            // 应用重力 (如果组件受重力影响)：F = g * m
-            if (pc->isUseGravity()) {
-                pc->addForce(gravity_ * pc->getMass());
-            }
-            /* 还可以添加其它力影响，比如风力、摩擦力等，目前不考虑 */
+    void PhysicsEngine::disableFixedTimestep()
+    {
+        fixed_timestep_.reset();
+        accumulator_ = 0.0f;
+        interpolation_alpha_ = 1.0f;
+        for (auto& body : bodies_) {
+            if (body.transform) body.transform->resetInterpolation();
+        }
+    }
 
-            // 更新速度： v += a * dt，其中 a = F / m
-            pc->velocity_ += (pc->getForce() / pc->getMass()) * delta_time;
-            pc->clearForce(); // 清除当前帧的力
+    void PhysicsEngine::savePreviousPositions()
+    {
+        for (auto& body : bodies_) {
+            if (body.transform) body.transform->savePreviousPosition();
+        }
+    }
+
+    void PhysicsEngine::addCollisionPair(engine::object::GameObject* a, engine::object::GameObject* b)
+    {
+        // 同一帧的多个子步可能重复检测到同一碰撞对，每帧的碰撞对很少，线性查找即可
+        for (const auto& [first, second] : collision_pairs_) {
+            if ((first == a && second == b) || (first == b && second == a)) return;
+        }
+        collision_pairs_.emplace_back(a, b);
+    }
+
+    void PhysicsEngine::addTileTriggerEvent(engine::object::GameObject* obj, engine::component::TileType type)
+    {
+        for (const auto& [event_obj, event_type] : tile_trigger_events_) {
+            if (event_obj == obj && event_type == type) return;
+        }
+        tile_trigger_events_.emplace_back(obj, type);
+        ENGINE_LOG_TRACE("tile_trigger_events_中 添加了 GameObject {} 和瓦片触发类型: {}",
+            obj->getName(), static_cast<int>(type));
+    }
+
+    void PhysicsEngine::step(float delta_time) {
+        ENGINE_PROFILE_SCOPE("PhysicsEngine::step");
+        // 批量积分所有启用的刚体： v += (g + F / m) * dt，并限制最大速度 (SoA 连续数组，可向量化)
+        /* 还可以添加其它力影响，比如风力、摩擦力等，目前不考虑 */
+        {
+            ENGINE_PROFILE_SCOPE("PhysicsEngine::integrate");
+            body_storage_.integrate(gravity_, max_speed_, delta_time);
+        }
+
+        // 遍历所有注册的刚体，处理位移与碰撞
+        {
+            ENGINE_PROFILE_SCOPE("PhysicsEngine::resolveTileCollisions");
+            std::uint64_t moved_bodies = 0;
+            for (auto& body : bodies_) {
+                auto* pc = body.physics;
+                if (!pc->isEnabled() || pc->isSleeping()) {     // 检查组件是否启用，休眠的刚体不会移动，保留上次的碰撞标志
+                    continue;
+                }
+                ++moved_bodies;
 
-            // 处理瓦片层碰撞（速度和位置的更新移入此函数）
-            resolveTileCollisions(pc, delta_time);
+                pc->resetCollisionFlags();  // 重置碰撞标志
 
-            // 应用世界边界
-            applyWorldBounds(pc);
+                // 处理瓦片层碰撞（位置的更新移入此函数）
+                resolveTileCollisions(body, delta_time);
+
+                // 应用世界边界
+                applyWorldBounds(body);
+            }
+            addFrameCounter(counter_ids_.bodies_integrated, moved_bodies);
         }
         // 处理对象间碰撞
         checkObjectCollisions();
 
+        // 更新休眠状态
+        updateSleepStates();
+
         // 检测瓦片触发事件 (检测前已经处理完位移)
         checkTileTriggers();
     }
 
+    glm::vec2 PhysicsEngine::getBroadphaseCellSize() const
+    {
+        if (broadphase_cell_size_) {
+            return *broadphase_cell_size_;
+        }
+        // 默认网格边长为 4 个瓦片：大多数对象只占 1~2 个瓦片，这样每个对象通常只落在 1~4 个网格中
+        constexpr float tiles_per_cell = 4.0f;
+        for (auto* layer : collision_tile_layers_) {
+            if (layer && layer->getTileSize().x > 0 && layer->getTileSize().y > 0) {
+                return glm::vec2(layer->getTileSize()) * tiles_per_cell;
+            }
+        }
+        return glm::vec2(64.0f, 64.0f);     // 没有瓦片层时的默认值
+    }
+
+    void PhysicsEngine::buildBroadphasePairs()
+    {
+        ENGINE_PROFILE_SCOPE("PhysicsEngine::buildBroadphasePairs");
+        broadphase_cells_.clear();
+        broadphase_pairs_.clear();
+
+        auto cell_size = getBroadphaseCellSize();
+        if (cell_size.x <= 0.0f || cell_size.y <= 0.0f) {
+            spdlog::warn("宽阶段网格尺寸无效: ({}, {})，使用默认值。", cell_size.x, cell_size.y);
+            cell_size = glm::vec2(64.0f, 64.0f);
+        }
+
+        // 1. 把每个有效碰撞器的 AABB 覆盖到的网格都记录下来
+        for (size_t i = 0; i < bodies_.size(); ++i) {
+            const auto& body = bodies_[i];
+            if (!body.physics->isEnabled() || !body.owner) continue;
+            auto* cc = body.collider;
+            if (!cc || !cc->isActive()) continue;
+
+            auto aabb = cc->getWorldAABB();
+            auto min_x = static_cast<int>(floor(aabb.position.x / cell_size.x));
+            auto min_y = static_cast<int>(floor(aabb.position.y / cell_size.y));
+            auto max_x = static_cast<int>(floor((aabb.position.x + aabb.size.x) / cell_size.x));
+            auto max_y = static_cast<int>(floor((aabb.position.y + aabb.size.y) / cell_size.y));
+            for (int y = min_y; y <= max_y; ++y) {
+                for (int x = min_x; x <= max_x; ++x) {
+                    // 网格键：高32位为y，低32位为x
+                    auto key = (static_cast<std::int64_t>(y) << 32) | static_cast<std::uint32_t>(x);
+                    broadphase_cells_.emplace_back(key, i);
+                }
+            }
+        }
+
+        // 2. 排序后同一网格的对象相邻（同一网格内按组件索引升序）
+        std::sort(broadphase_cells_.begin(), broadphase_cells_.end());
+
+        // 3. 同一网格内的对象两两组成候选碰撞对
+        for (size_t begin = 0; begin < broadphase_cells_.size();) {
+            auto end = begin + 1;
+            while (end < broadphase_cells_.size() && broadphase_cells_[end].first == broadphase_cells_[begin].first) {
+                ++end;
+            }
+            for (auto a = begin; a < end; ++a) {
+                for (auto b = a + 1; b < end; ++b) {
+                    broadphase_pairs_.emplace_back(broadphase_cells_[a].second, broadphase_cells_[b].second);
+                }
+            }
+            begin = end;
+        }
+
+        // 4. 跨越多个网格的对象可能产生重复的碰撞对，排序去重（同时保证与原两层循环相同的处理顺序）
+        std::sort(broadphase_pairs_.begin(), broadphase_pairs_.end());
+        broadphase_pairs_.erase(std::unique(broadphase_pairs_.begin(), broadphase_pairs_.end()), broadphase_pairs_.end());
+    }
+
     void PhysicsEngine::checkObjectCollisions()
     {
-        // 两层循环遍历所有包含物理组件的 GameObject
-        for (size_t i = 0; i < components_.size(); ++i) {
-            auto* pc_a = components_[i];
-            if (!pc_a || !pc_a->isEnabled()) continue;
-            auto* obj_a = pc_a->getOwner();
-            if (!obj_a) continue;
-            auto* cc_a = obj_a->getComponent<engine::component::ColliderComponent>();
-            if (!cc_a || !cc_a->isActive()) continue;
-
-            for (size_t j = i + 1; j < components_.size(); ++j) {
-                auto* pc_b = components_[j];
-                if (!pc_b || !pc_b->isEnabled()) continue;
-                auto* obj_b = pc_b->getOwner();
-                if (!obj_b) continue;
-                auto* cc_b = obj_b->getComponent<engine::component::ColliderComponent>();
-                if (!cc_b || !cc_b->isActive()) continue;
-                /* --- 通过保护性测试后，正式执行逻辑 --- */
-
-                if (collision::checkCollision(*cc_a, *cc_b)) {
-                    // 如果是可移动物体与SOLID物体碰撞，则直接处理位置变化，不用记录碰撞对
-                    if (obj_a->getTag() != "solid" && obj_b->getTag() == "solid") {
-                        resolveSolidObjectCollisions(obj_a, obj_b);
-                    }
-                    else if (obj_a->getTag() == "solid" && obj_b->getTag() != "solid") {
-                        resolveSolidObjectCollisions(obj_b, obj_a);
-                    }
-                    else {
-                        // 记录碰撞对
-                        collision_pairs_.emplace_back(obj_a, obj_b);
-                    }
+        ENGINE_PROFILE_SCOPE("PhysicsEngine::checkObjectCollisions");
+        // 宽阶段：只有共享网格的对象才需要进行精确检测
+        buildBroadphasePairs();
+        addFrameCounter(counter_ids_.pair_tests, broadphase_pairs_.size());
+
+        std::uint64_t solid_resolutions = 0;
+        for (const auto& [i, j] : broadphase_pairs_) {
+            auto& body_a = bodies_[i];
+            auto& body_b = bodies_[j];
+            auto* obj_a = body_a.owner;
+            auto* obj_b = body_b.owner;
+            /* --- 宽阶段已经完成保护性测试，正式执行逻辑 --- */
+
+            if (collision::checkCollision(*body_a.collider, *body_b.collider)) {
+                // 与运动中的清醒刚体接触时唤醒休眠的刚体
+                wakeOnContact(body_a, body_b);
+                wakeOnContact(body_b, body_a);
+                // 如果是可移动物体与SOLID物体碰撞，则直接处理位置变化，不用记录碰撞对
+                if (obj_a->getTag() != "solid" && obj_b->getTag() == "solid") {
+                    resolveSolidObjectCollisions(body_a, body_b);
+                    ++solid_resolutions;
+                }
+                else if (obj_a->getTag() == "solid" && obj_b->getTag() != "solid") {
+                    resolveSolidObjectCollisions(body_b, body_a);
+                    ++solid_resolutions;
+                }
+                else {
+                    // 记录碰撞对
+                    addCollisionPair(obj_a, obj_b);
+                }
+            }
+        }
+        addFrameCounter(counter_ids_.solid_resolutions, solid_resolutions);
+    }
+
+    void PhysicsEngine::setSleepEnabled(bool enabled)
+    {
+        sleep_enabled_ = enabled;
+        if (!sleep_enabled_) {
+            for (auto& body : bodies_) {
+                body.physics->wakeUp();
+            }
+        }
+    }
+
+    void PhysicsEngine::wakeOnContact(PhysicsBody& body, const PhysicsBody& other)
+    {
+        if (!body.physics->isSleeping() || other.physics->isSleeping()) return;
+        auto other_velocity = other.physics->getVelocity();
+        if (glm::abs(other_velocity.x) >= sleep_velocity_threshold_ || glm::abs(other_velocity.y) >= sleep_velocity_threshold_) {
+            body.physics->wakeUp();
+        }
+    }
+
+    void PhysicsEngine::updateSleepStates()
+    {
+        ENGINE_PROFILE_SCOPE("PhysicsEngine::updateSleepStates");
+        awake_body_count_ = 0;
+        sleeping_body_count_ = 0;
+        for (auto& body : bodies_) {
+            auto* pc = body.physics;
+            if (!pc->isEnabled()) continue;
+            if (pc->isSleeping()) {
+                ++sleeping_body_count_;
+                continue;
+            }
+            // 只有着地且速度足够小的刚体才累计静止帧数（空中的刚体即使速度很小也会继续下落）
+            auto velocity = pc->getVelocity();
+            if (sleep_enabled_ && pc->hasCollidedBelow() &&
+                glm::abs(velocity.x) < sleep_velocity_threshold_ && glm::abs(velocity.y) < sleep_velocity_threshold_) {
+                if (++pc->resting_frames_ >= sleep_frames_) {
+                    pc->sleep();
+                    ++sleeping_body_count_;
+                    continue;
                 }
             }
+            else {
+                pc->resting_frames_ = 0;
+            }
+            ++awake_body_count_;
         }
     }
 
-    void PhysicsEngine::resolveTileCollisions(engine::component::PhysicsComponent* pc, float delta_time) {
+    void PhysicsEngine::resolveTileCollisions(PhysicsBody& body, float delta_time) {
         // 检查组件是否有效
-        auto* obj = pc->getOwner();
-        if (!obj) return;
-        auto* tc = obj->getComponent<engine::component::TransformComponent>();
-        auto* cc = obj->getComponent<engine::component::ColliderComponent>();
+        auto* pc = body.physics;
+        auto* tc = body.transform;
+        auto* cc = body.collider;
         if (!tc || !cc || cc->isTrigger()) return;
         auto world_aabb = cc->getWorldAABB();   // 使用最小包围盒进行碰撞检测（简化）
         auto obj_pos = world_aabb.position;
@@ -123,141 +388,160 @@ namespace engine::physics {
         // -- 检查结束, 正式开始处理 --
 
         constexpr float tolerance = 1.0f;       // 检查右边缘和下边缘时，需要减1像素，否则会检查到下一行/列的瓦片
-        auto ds = pc->velocity_ * delta_time;  // 计算物体在delta_time内的位移
+        auto velocity = pc->getVelocity();      // 速度已在积分阶段限制了最大值，这里使用局部副本，最后写回
+        auto ds = velocity * delta_time;        // 计算物体在delta_time内的位移
         auto new_obj_pos = obj_pos + ds;        // 计算物体在delta_time后的新位置
 
         if (!cc->isActive()) {  // 如果碰撞器未激活，直接让物体正常移动，然后返回。
             tc->translate(ds);
-            pc->velocity_ = glm::clamp(pc->velocity_, -max_speed_, max_speed_);
             return;
         }
 
         // 遍历所有注册的碰撞瓦片层
+        std::uint64_t tile_probes = 0;
         for (auto* layer : collision_tile_layers_) {
             if (!layer) continue;
-            auto tile_size = layer->getTileSize();
-            // 轴分离碰撞检测：先检查X方向是否有碰撞 (y方向使用初始值obj_pos.y)
+            auto tile_size = glm::vec2(layer->getTileSize());
+            if (tile_size.x <= 0.0f || tile_size.y <= 0.0f) continue;
+            // 查询瓦片类型并计数
+            auto probe = [layer, &tile_probes](glm::ivec2 pos) {
+                ++tile_probes;
+                return layer->getTileTypeFast(pos);
+            };
+
+            // 物体当前覆盖的瓦片行/列范围（轴分离：x 方向检测使用初始 y，y 方向检测使用初始 x）
+            auto row_top = static_cast<int>(floor(obj_pos.y / tile_size.y));
+            auto row_bottom = static_cast<int>(floor((obj_pos.y + obj_size.y - tolerance) / tile_size.y));
+            auto col_left = static_cast<int>(floor(obj_pos.x / tile_size.x));
+            auto col_right = static_cast<int>(floor((obj_pos.x + obj_size.x - tolerance) / tile_size.x));
+
+            // 判断某一列 / 某一行在物体覆盖范围内是否有阻挡瓦片（one_way 为 true 时单向平台也算阻挡）
+            auto is_column_blocked = [&probe, row_top, row_bottom](int tile_x) {
+                for (int y = row_top; y <= row_bottom; ++y) {
+                    if (probe({ tile_x, y }) == engine::component::TileType::SOLID) return true;
+                }
+                return false;
+            };
+            auto is_row_blocked = [&probe, col_left, col_right](int tile_y, bool one_way) {
+                for (int x = col_left; x <= col_right; ++x) {
+                    auto type = probe({ x, tile_y });
+                    if (type == engine::component::TileType::SOLID ||
+                        (one_way && type == engine::component::TileType::UNISOLID)) return true;
+                }
+                return false;
+            };
+
+            // 轴分离连续碰撞检测：先处理X方向。沿运动方向逐列扫描（DDA 网格遍历），在第一个阻挡列停下，
+            // 因此无论位移多大都不会穿过瓦片。扫描范围总是包含目标列（与只检测目标位置的结果保持一致）。
             if (ds.x > 0.0f) {
-                // 检查右侧碰撞，需要分别测试右上和右下角
-                auto right_top_x = new_obj_pos.x + obj_size.x;
-                auto tile_x = static_cast<int>(floor(right_top_x / tile_size.x));   // 获取x方向瓦片坐标
-                // y方向坐标有两个，右上和右下
-                auto tile_y = static_cast<int>(floor(obj_pos.y / tile_size.y));
-                auto tile_type_top = layer->getTileTypeAt({ tile_x, tile_y });        // 右上角瓦片类型
-                auto tile_y_bottom = static_cast<int>(floor((obj_pos.y + obj_size.y - tolerance) / tile_size.y));
-                auto tile_type_bottom = layer->getTileTypeAt({ tile_x, tile_y_bottom });     // 右下角瓦片类型
-
-                if (tile_type_top == engine::component::TileType::SOLID || tile_type_bottom == engine::component::TileType::SOLID) {
-                    // 撞墙了！速度归零，x方向移动到贴着墙的位置
-                    new_obj_pos.x = tile_x * layer->getTileSize().x - obj_size.x;
-                    pc->velocity_.x = 0.0f;
-                    pc->setCollidedRight(true);
+                auto last_x = static_cast<int>(floor((new_obj_pos.x + obj_size.x) / tile_size.x));
+                auto first_x = glm::min(col_right + 1, last_x);
+                bool blocked = false;
+                for (int tile_x = first_x; tile_x <= last_x; ++tile_x) {
+                    if (is_column_blocked(tile_x)) {
+                        // 撞墙了！速度归零，x方向移动到贴着墙的位置
+                        new_obj_pos.x = tile_x * tile_size.x - obj_size.x;
+                        velocity.x = 0.0f;
+                        pc->setCollidedRight(true);
+                        blocked = true;
+                        break;
+                    }
                 }
-                else {
+                if (!blocked) {
                     // 检测右下角斜坡瓦片
-                    auto width_right = new_obj_pos.x + obj_size.x - tile_x * tile_size.x;
+                    auto tile_type_bottom = probe({ last_x, row_bottom });
+                    auto width_right = new_obj_pos.x + obj_size.x - last_x * tile_size.x;
                     auto height_right = getTileHeightAtWidth(width_right, tile_type_bottom, tile_size);
                     if (height_right > 0.0f) {
                         // 如果有碰撞（角点的世界y坐标 > 斜坡地面的世界y坐标）, 就让物体贴着斜坡表面
-                        if (new_obj_pos.y > (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_right) {
-                            new_obj_pos.y = (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_right;
+                        if (new_obj_pos.y > (row_bottom + 1) * tile_size.y - obj_size.y - height_right) {
+                            new_obj_pos.y = (row_bottom + 1) * tile_size.y - obj_size.y - height_right;
                             pc->setCollidedBelow(true);
                         }
                     }
                 }
             }
             else if (ds.x < 0.0f) {
-                // 检查左侧碰撞，需要分别测试左上和左下角
-                auto left_top_x = new_obj_pos.x;
-                auto tile_x = static_cast<int>(floor(left_top_x / tile_size.x));    // 获取x方向瓦片坐标
-                // y方向坐标有两个，左上和左下
-                auto tile_y = static_cast<int>(floor(obj_pos.y / tile_size.y));
-                auto tile_type_top = layer->getTileTypeAt({ tile_x, tile_y });        // 左上角瓦片类型
-                auto tile_y_bottom = static_cast<int>(floor((obj_pos.y + obj_size.y - tolerance) / tile_size.y));
-                auto tile_type_bottom = layer->getTileTypeAt({ tile_x, tile_y_bottom });     // 左下角瓦片类型
-
-                if (tile_type_top == engine::component::TileType::SOLID || tile_type_bottom == engine::component::TileType::SOLID) {
-                    // 撞墙了！速度归零，x方向移动到贴着墙的位置
-                    new_obj_pos.x = (tile_x + 1) * layer->getTileSize().x;
-                    pc->velocity_.x = 0.0f;
-                    pc->setCollidedLeft(true);
+                auto last_x = static_cast<int>(floor(new_obj_pos.x / tile_size.x));
+                auto first_x = glm::max(col_left - 1, last_x);
+                bool blocked = false;
+                for (int tile_x = first_x; tile_x >= last_x; --tile_x) {
+                    if (is_column_blocked(tile_x)) {
+                        // 撞墙了！速度归零，x方向移动到贴着墙的位置
+                        new_obj_pos.x = (tile_x + 1) * tile_size.x;
+                        velocity.x = 0.0f;
+                        pc->setCollidedLeft(true);
+                        blocked = true;
+                        break;
+                    }
                 }
-                else {
+                if (!blocked) {
                     // 检测左下角斜坡瓦片
-                    auto width_left = new_obj_pos.x - tile_x * tile_size.x;
+                    auto tile_type_bottom = probe({ last_x, row_bottom });
+                    auto width_left = new_obj_pos.x - last_x * tile_size.x;
                     auto height_left = getTileHeightAtWidth(width_left, tile_type_bottom, tile_size);
                     if (height_left > 0.0f) {
-                        if (new_obj_pos.y > (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_left) {
-                            new_obj_pos.y = (tile_y_bottom + 1) * layer->getTileSize().y - obj_size.y - height_left;
+                        if (new_obj_pos.y > (row_bottom + 1) * tile_size.y - obj_size.y - height_left) {
+                            new_obj_pos.y = (row_bottom + 1) * tile_size.y - obj_size.y - height_left;
                             pc->setCollidedBelow(true);
                         }
                     }
                 }
             }
-            // 轴分离碰撞检测：再检查Y方向是否有碰撞 (x方向使用初始值obj_pos.x)
+            // 再处理Y方向，同样逐行扫描
             if (ds.y > 0.0f) {
-                // 检查底部碰撞，需要分别测试左下和右下角
-                auto bottom_left_y = new_obj_pos.y + obj_size.y;
-                auto tile_y = static_cast<int>(floor(bottom_left_y / tile_size.y));
-
-                auto tile_x = static_cast<int>(floor(obj_pos.x / tile_size.x));
-                auto tile_type_left = layer->getTileTypeAt({ tile_x, tile_y });           // 左下角瓦片类型   
-                auto tile_x_right = static_cast<int>(floor((obj_pos.x + obj_size.x - tolerance) / tile_size.x));
-                auto tile_type_right = layer->getTileTypeAt({ tile_x_right, tile_y });     // 右下角瓦片类型
-
-                if (tile_type_left == engine::component::TileType::SOLID || tile_type_right == engine::component::TileType::SOLID ||
-                    tile_type_left == engine::component::TileType::UNISOLID || tile_type_right == engine::component::TileType::UNISOLID) {
-                    // 到达地面！速度归零，y方向移动到贴着地面的位置
-                    new_obj_pos.y = tile_y * layer->getTileSize().y - obj_size.y;
-                    pc->velocity_.y = 0.0f;
-                    pc->setCollidedBelow(true);
-                }
-                else {
-                    // 检测斜坡瓦片（下方两个角点都要检测）
-                    auto width_left = obj_pos.x - tile_x * tile_size.x;
-                    auto width_right = obj_pos.x + obj_size.x - tile_x_right * tile_size.x;
-                    auto height_left = getTileHeightAtWidth(width_left, tile_type_left, tile_size);
-                    auto height_right = getTileHeightAtWidth(width_right, tile_type_right, tile_size);
+                auto last_y = static_cast<int>(floor((new_obj_pos.y + obj_size.y) / tile_size.y));
+                auto first_y = glm::min(row_bottom + 1, last_y);
+                for (int tile_y = first_y; tile_y <= last_y; ++tile_y) {
+                    if (is_row_blocked(tile_y, true)) {
+                        // 到达地面！速度归零，y方向移动到贴着地面的位置
+                        new_obj_pos.y = tile_y * tile_size.y - obj_size.y;
+                        velocity.y = 0.0f;
+                        pc->setCollidedBelow(true);
+                        break;
+                    }
+                    // 检测斜坡瓦片（下方两个角点都要检测，中途经过的斜坡同样会挡住物体）
+                    auto width_left = obj_pos.x - col_left * tile_size.x;
+                    auto width_right = obj_pos.x + obj_size.x - col_right * tile_size.x;
+                    auto height_left = getTileHeightAtWidth(width_left, probe({ col_left, tile_y }), tile_size);
+                    auto height_right = getTileHeightAtWidth(width_right, probe({ col_right, tile_y }), tile_size);
                     auto height = glm::max(height_left, height_right);  // 找到两个角点的最高点进行检测
-                    if (height > 0.0f) {    // 说明至少有一个角点处于斜坡瓦片
-                        if (new_obj_pos.y > (tile_y + 1) * layer->getTileSize().y - obj_size.y - height) {
-                            new_obj_pos.y = (tile_y + 1) * layer->getTileSize().y - obj_size.y - height;
-                            pc->velocity_.y = 0.0f;     // 只有向下运动时才需要让 y 速度归零
-                            pc->setCollidedBelow(true);
-                        }
+                    if (height > 0.0f && new_obj_pos.y > (tile_y + 1) * tile_size.y - obj_size.y - height) {
+                        new_obj_pos.y = (tile_y + 1) * tile_size.y - obj_size.y - height;
+                        velocity.y = 0.0f;     // 只有向下运动时才需要让 y 速度归零
+                        pc->setCollidedBelow(true);
+                        break;
                     }
                 }
             }
             else if (ds.y < 0.0f) {
-                // 检查顶部碰撞，需要分别测试左上和右上角
-                auto top_left_y = new_obj_pos.y;
-                auto tile_y = static_cast<int>(floor(top_left_y / tile_size.y));
-
-                auto tile_x = static_cast<int>(floor(obj_pos.x / tile_size.x));
-                auto tile_type_left = layer->getTileTypeAt({ tile_x, tile_y });        // 左上角瓦片类型
-                auto tile_x_right = static_cast<int>(floor((obj_pos.x + obj_size.x - tolerance) / tile_size.x));
-                auto tile_type_right = layer->getTileTypeAt({ tile_x_right, tile_y });     // 右上角瓦片类型
-
-                if (tile_type_left == engine::component::TileType::SOLID || tile_type_right == engine::component::TileType::SOLID) {
-                    // 撞到天花板！速度归零，y方向移动到贴着天花板的位置
-                    new_obj_pos.y = (tile_y + 1) * layer->getTileSize().y;
-                    pc->velocity_.y = 0.0f;
-                    pc->setCollidedAbove(true);
+                auto last_y = static_cast<int>(floor(new_obj_pos.y / tile_size.y));
+                auto first_y = glm::max(row_top - 1, last_y);
+                for (int tile_y = first_y; tile_y >= last_y; --tile_y) {
+                    if (is_row_blocked(tile_y, false)) {
+                        // 撞到天花板！速度归零，y方向移动到贴着天花板的位置
+                        new_obj_pos.y = (tile_y + 1) * tile_size.y;
+                        velocity.y = 0.0f;
+                        pc->setCollidedAbove(true);
+                        break;
+                    }
                 }
             }
         }
-        // 更新物体位置，并限制最大速度
+        addFrameCounter(counter_ids_.tile_probes, tile_probes);
+        // 更新物体位置和速度
         tc->translate(new_obj_pos - obj_pos);   // 使用translate方法，避免直接设置位置，因为碰撞盒可能有偏移量
-        pc->velocity_ = glm::clamp(pc->velocity_, -max_speed_, max_speed_);
+        pc->setVelocity(velocity);
     }
 
-    void PhysicsEngine::resolveSolidObjectCollisions(engine::object::GameObject* move_obj, engine::object::GameObject* solid_obj)
+    void PhysicsEngine::resolveSolidObjectCollisions(PhysicsBody& move_body, const PhysicsBody& solid_body)
     {
-        // 进入此函数前，已经检查了各个组件的有效性，因此直接进行计算
-        auto* move_tc = move_obj->getComponent<engine::component::TransformComponent>();
-        auto* move_pc = move_obj->getComponent<engine::component::PhysicsComponent>();
-        auto* move_cc = move_obj->getComponent<engine::component::ColliderComponent>();
-        auto* solid_cc = solid_obj->getComponent<engine::component::ColliderComponent>();
+        // 进入此函数前，已经检查了碰撞器的有效性，因此直接进行计算
+        auto* move_tc = move_body.transform;
+        auto* move_pc = move_body.physics;
+        auto* move_cc = move_body.collider;
+        auto* solid_cc = solid_body.collider;
+        if (!move_tc) return;
 
         // 这里只能获取期望位置，无法获取当前帧初始位置，因此无法进行轴分离碰撞检测
         /* 未来可以进行重构，让这里可以获取初始位置。但是我们展示另外一种处理方法 */
@@ -276,16 +560,16 @@ namespace engine::physics {
                 // 移动物体在左边，让它贴着右边SOLID物体（相当于向左移出重叠部分），y方向正常移动
                 move_tc->translate(glm::vec2(-overlap.x, 0.0f));
                 // 如果速度为正(向右移动)，则归零 （if判断不可少，否则可能出现错误吸附）
-                if (move_pc->velocity_.x > 0.0f) {
-                    move_pc->velocity_.x = 0.0f;
+                if (move_pc->getVelocity().x > 0.0f) {
+                    move_pc->setVelocityX(0.0f);
                     move_pc->setCollidedRight(true);
                 }
             }
             else {
                 // 移动物体在右边，让它贴着左边SOLID物体（相当于向右移出重叠部分），y方向正常移动
                 move_tc->translate(glm::vec2(overlap.x, 0.0f));
-                if (move_pc->velocity_.x < 0.0f) {
-                    move_pc->velocity_.x = 0.0f;
+                if (move_pc->getVelocity().x < 0.0f) {
+                    move_pc->setVelocityX(0.0f);
                     move_pc->setCollidedLeft(true);
                 }
             }
@@ -294,16 +578,16 @@ namespace engine::physics {
             if (move_center.y < solid_center.y) {
                 // 移动物体在上面，让它贴着下面SOLID物体（相当于向上移出重叠部分），x方向正常移动
                 move_tc->translate(glm::vec2(0.0f, -overlap.y));
-                if (move_pc->velocity_.y > 0.0f) {
-                    move_pc->velocity_.y = 0.0f;
+                if (move_pc->getVelocity().y > 0.0f) {
+                    move_pc->setVelocityY(0.0f);
                     move_pc->setCollidedBelow(true);
                 }
             }
             else {
                 // 移动物体在下面，让它贴着上面SOLID物体（相当于向下移出重叠部分），x方向正常移动
                 move_tc->translate(glm::vec2(0.0f, overlap.y));
-                if (move_pc->velocity_.y < 0.0f) {
-                    move_pc->velocity_.y = 0.0f;
+                if (move_pc->getVelocity().y < 0.0f) {
+                    move_pc->setVelocityY(0.0f);
                     move_pc->setCollidedAbove(true);
                 }
             }
@@ -333,18 +617,18 @@ namespace engine::physics {
 
     void PhysicsEngine::checkTileTriggers()
     {
-        for (auto* pc : components_) {
-            if (!pc || !pc->isEnabled()) continue;  // 检查组件是否有效和启用
-            auto* obj = pc->getOwner();
-            if (!obj) continue;
-            auto* cc = obj->getComponent<engine::component::ColliderComponent>();
+        ENGINE_PROFILE_SCOPE("PhysicsEngine::checkTileTriggers");
+        for (const auto& body : bodies_) {
+            if (!body.physics->isEnabled() || !body.owner) continue;   // 检查组件是否启用
+            auto* obj = body.owner;
+            auto* cc = body.collider;
             if (!cc || !cc->isActive() || cc->isTrigger()) continue;    // 如果游戏对象本就是触发器，则不需要检查瓦片触发事件
 
             // 获取物体的世界AABB
             auto world_aabb = cc->getWorldAABB();
 
-            // 使用 set 来跟踪循环遍历中已经触发过的瓦片类型，防止重复添加（例如，玩家同时踩到两个尖刺，只需要受到一次伤害）
-            std::set<engine::component::TileType> triggers_set;
+            // 使用位掩码记录已经触发过的瓦片类型，防止重复添加（例如，玩家同时踩到两个尖刺，只需要受到一次伤害）
+            std::uint32_t triggered_mask = 0;
 
             // 遍历所有注册的碰撞瓦片层分别进行检测
             for (auto* layer : collision_tile_layers_) {
@@ -356,54 +640,63 @@ namespace engine::physics {
                 auto end_x = static_cast<int>(ceil((world_aabb.position.x + world_aabb.size.x - tolerance) / tile_size.x));
                 auto start_y = static_cast<int>(floor(world_aabb.position.y / tile_size.y));
                 auto end_y = static_cast<int>(ceil((world_aabb.position.y + world_aabb.size.y - tolerance) / tile_size.y));
+                // 先把范围限制在地图内，循环中即可使用无边界检查的查询
+                auto map_size = layer->getMapSize();
+                start_x = glm::max(start_x, 0);
+                start_y = glm::max(start_y, 0);
+                end_x = glm::min(end_x, map_size.x);
+                end_y = glm::min(end_y, map_size.y);
+                if (end_x > start_x && end_y > start_y) {
+                    addFrameCounter(counter_ids_.tile_probes, static_cast<std::uint64_t>(end_x - start_x) * (end_y - start_y));
+                }
 
                 // 遍历瓦片坐标范围进行检测
                 for (int x = start_x; x < end_x; ++x) {
                     for (int y = start_y; y < end_y; ++y) {
-                        auto tile_type = layer->getTileTypeAt({ x, y });
+                        auto tile_type = layer->getTileTypeUnchecked({ x, y });
                         // 未来可以添加更多触发器类型的瓦片，目前只有 HAZARD 类型
                         if (tile_type == engine::component::TileType::HAZARD) {
-                            triggers_set.insert(tile_type);     // 记录触发事件，set 保证每个瓦片类型只记录一次
+                            triggered_mask |= 1u << static_cast<std::uint32_t>(tile_type);     // 每个瓦片类型只记录一次
                         }
                     }
                 }
-                // 遍历触发事件集合，添加到 tile_trigger_events_ 中
-                for (const auto& type : triggers_set) {
-                    tile_trigger_events_.emplace_back(obj, type);
-                    spdlog::trace("tile_trigger_events_中 添加了 GameObject {} 和瓦片触发类型: {}",
-                        obj->getName(), static_cast<int>(type));
+            }
+            // 按瓦片类型顺序把触发事件添加到 tile_trigger_events_ 中 (所有图层检测完毕后统一添加)
+            for (std::uint32_t type = 0; triggered_mask != 0; ++type, triggered_mask >>= 1) {
+                if (triggered_mask & 1u) {
+                    addTileTriggerEvent(obj, static_cast<engine::component::TileType>(type));
                 }
             }
         }
     }
 
-    void PhysicsEngine::applyWorldBounds(engine::component::PhysicsComponent* pc)
+    void PhysicsEngine::applyWorldBounds(PhysicsBody& body)
     {
-        if (!pc || !world_bounds_) return;
+        auto* pc = body.physics;
+        auto* cc = body.collider;
+        auto* tc = body.transform;
+        if (!world_bounds_ || !cc || !tc) return;
 
         // 只限定左、上、右边界，不限定下边界，以碰撞盒作为判断依据
-        auto* obj = pc->getOwner();
-        auto* cc = obj->getComponent<engine::component::ColliderComponent>();
-        auto* tc = obj->getComponent<engine::component::TransformComponent>();
         auto world_aabb = cc->getWorldAABB();
         auto obj_pos = world_aabb.position;
         auto obj_size = world_aabb.size;
 
         // 检查左边界
         if (obj_pos.x < world_bounds_->position.x) {
-            pc->velocity_.x = 0.0f;
+            pc->setVelocityX(0.0f);
             obj_pos.x = world_bounds_->position.x;
             pc->setCollidedLeft(true);
         }
         // 检查上边界
         if (obj_pos.y < world_bounds_->position.y) {
-            pc->velocity_.y = 0.0f;
+            pc->setVelocityY(0.0f);
             obj_pos.y = world_bounds_->position.y;
             pc->setCollidedAbove(true);
         }
         // 检查右边界
         if (obj_pos.x + obj_size.x > world_bounds_->position.x + world_bounds_->size.x) {
-            pc->velocity_.x = 0.0f;
+            pc->setVelocityX(0.0f);
             obj_pos.x = world_bounds_->position.x + world_bounds_->size.x - obj_size.x;
             pc->setCollidedRight(true);
         }
@@ -1,14 +1,20 @@
 #pragma once
 #include "../utils/math.h"
+#include "body_storage.h"
+#include "../core/frame_counters.h"
 #include <vector>
+#include <memory_resource>
 #include <utility>  // for std::pair
 #include <optional>
+#include <cstdint>
 #include <glm/vec2.hpp>
 
 namespace engine::component {
     class PhysicsComponent;
+    class TransformComponent;
+    class ColliderComponent;
     class TileLayerComponent;
-    enum class TileType;
+    enum class TileType : std::uint8_t;
 }
 
 namespace engine::object {
@@ -17,21 +23,66 @@ namespace engine::object {
 
 namespace engine::physics {
 
+    /**
+     * @brief 物理引擎内部的刚体记录，缓存同一 GameObject 上与物理相关的组件指针 (均为非拥有指针)。
+     *
+     * 注册时构建，所属 GameObject 增删组件时刷新，因此物理热循环中不需要再调用 getComponent。
+     */
+    struct PhysicsBody {
+        engine::component::PhysicsComponent* physics = nullptr;     ///< @brief 物理组件 (不为空)
+        engine::component::TransformComponent* transform = nullptr; ///< @brief 变换组件 (可能为空)
+        engine::component::ColliderComponent* collider = nullptr;   ///< @brief 碰撞器组件 (可能为空)
+        engine::object::GameObject* owner = nullptr;                ///< @brief 所属游戏对象
+    };
+
     /**
      * @brief 负责管理和模拟物理行为及碰撞检测。
      */
     class PhysicsEngine {
     private:
-        std::vector<engine::component::PhysicsComponent*> components_; ///< @brief 注册的物理组件容器，非拥有指针
+        std::vector<PhysicsBody> bodies_;           ///< @brief 注册的刚体记录（每个物理组件一条）
+        BodyStorage body_storage_;                  ///< @brief 刚体动力学数据 (SoA)，下标与 bodies_ 一一对应
         std::vector<engine::component::TileLayerComponent*> collision_tile_layers_; ///< @brief 注册的碰撞瓦片图层容器
         glm::vec2 gravity_ = { 0.0f, 980.0f };        ///< @brief 默认重力值 (像素/秒^2, 相当于100像素对应现实1m)
         float max_speed_ = 500.0f;                  ///< @brief 最大速度 (像素/秒)
         std::optional<engine::utils::Rect> world_bounds_;     ///< @brief 世界边界，用于限制物体移动范围
 
-        /// @brief 存储本帧发生的 GameObject 碰撞对 （每次 update 开始时清空）
-        std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>> collision_pairs_;
-        /// @brief 存储本帧发生的瓦片触发事件 (GameObject*, 触发的瓦片类型, 每次 update 开始时清空)
-        std::vector<std::pair<engine::object::GameObject*, engine::component::TileType>> tile_trigger_events_;
+        // --- 固定时间步长 ---
+        std::optional<float> fixed_timestep_;       ///< @brief 固定步长 (秒)，空值表示直接使用每帧的 delta_time
+        int max_substeps_ = 8;                      ///< @brief 每帧最多执行的子步数
+        float accumulator_ = 0.0f;                  ///< @brief 尚未模拟的累计时间
+        float interpolation_alpha_ = 1.0f;          ///< @brief 渲染插值系数 = accumulator_ / fixed_timestep_
+        int last_substeps_ = 0;                     ///< @brief 上一次 update 执行的子步数
+
+        // --- 休眠 ---
+        bool sleep_enabled_ = true;                 ///< @brief 是否允许刚体休眠
+        float sleep_velocity_threshold_ = 1.0f;     ///< @brief 速度分量都低于此值 (像素/秒) 才视为静止
+        int sleep_frames_ = 30;                     ///< @brief 连续着地且静止多少帧后进入休眠
+        size_t awake_body_count_ = 0;               ///< @brief 上一次 update 结束时处于清醒状态的（启用）刚体数量
+        size_t sleeping_body_count_ = 0;            ///< @brief 上一次 update 结束时处于休眠状态的（启用）刚体数量
+
+        // --- 每帧的临时结果，从帧分配器分配（每次 update 开始时重新创建）---
+        std::pmr::memory_resource* frame_resource_ = std::pmr::get_default_resource();  ///< @brief 临时结果使用的分配器
+        /// @brief 存储本帧发生的 GameObject 碰撞对
+        std::pmr::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>> collision_pairs_;
+        /// @brief 存储本帧发生的瓦片触发事件 (GameObject*, 触发的瓦片类型)
+        std::pmr::vector<std::pair<engine::object::GameObject*, engine::component::TileType>> tile_trigger_events_;
+
+        // --- 宽阶段（Broadphase）均匀网格，每帧重建，容器只清空不释放，避免反复分配 ---
+        std::optional<glm::vec2> broadphase_cell_size_;     ///< @brief 手动指定的网格尺寸，空值表示根据瓦片尺寸自动计算
+        std::vector<std::pair<std::int64_t, size_t>> broadphase_cells_;             ///< @brief (网格键, 刚体索引) 列表，排序后同一网格相邻
+        std::vector<std::pair<size_t, size_t>> broadphase_pairs_;                   ///< @brief 候选碰撞对 (刚体索引 i < j)
+
+        // --- 每帧计数器 ---
+        /// @brief 注册到 FrameCounters 的计数器编号
+        struct CounterIds {
+            engine::core::CounterId bodies_integrated = 0;  ///< @brief 参与积分与瓦片碰撞处理的刚体数（每个子步分别计数）
+            engine::core::CounterId tile_probes = 0;        ///< @brief 瓦片类型查询次数（瓦片碰撞与瓦片触发）
+            engine::core::CounterId pair_tests = 0;         ///< @brief 窄阶段精确检测的碰撞对数量
+            engine::core::CounterId solid_resolutions = 0;  ///< @brief 与 SOLID 对象发生碰撞并修正位置的次数
+        };
+        engine::core::FrameCounters* frame_counters_ = nullptr;     ///< @brief 每帧计数器注册表（非拥有，可能为空）
+        CounterIds counter_ids_;                                    ///< @brief 计数器编号
 
     public:
         PhysicsEngine() = default;
@@ -44,12 +95,21 @@ namespace engine::physics {
 
         void registerComponent(engine::component::PhysicsComponent* component);     ///< @brief 注册物理组件
         void unregisterComponent(engine::component::PhysicsComponent* component);   ///< @brief 注销物理组件
+        void refreshComponent(engine::component::PhysicsComponent* component);      ///< @brief 重新获取物理组件所属对象的组件指针（组件增删后调用）
 
         // 如果瓦片层需要进行碰撞检测则注册。（不需要则不必注册）
         void registerCollisionLayer(engine::component::TileLayerComponent* layer);  ///< @brief 注册用于碰撞检测的 TileLayerComponent
         void unregisterCollisionLayer(engine::component::TileLayerComponent* layer);///< @brief 注销用于碰撞检测的 TileLayerComponent
 
-        void update(float delta_time);      ///< @brief 核心循环：更新所有注册的物理组件的状态
+        /**
+         * @brief 核心循环：更新所有注册的物理组件的状态。
+         *
+         * 固定步长模式下累计 delta_time，并按固定步长执行若干子步（最多 max_substeps_ 个），
+         * 剩余时间用于计算渲染插值系数；否则直接以 delta_time 执行一步。
+         * 碰撞对和瓦片触发事件在每次调用开始时清空，并汇总本帧所有子步的结果（去重）。
+         */
+        void update(float delta_time);
+        size_t getBodyCount() const { return bodies_.size(); }   ///< @brief 获取注册的刚体数量
 
         // 设置器/获取器
         void setGravity(const glm::vec2& gravity) { gravity_ = gravity; }   ///< @brief 设置全局重力加速度
@@ -58,22 +118,68 @@ namespace engine::physics {
         float getMaxSpeed() const { return max_speed_; }                    ///< @brief 获取当前的最大速度
         void setWorldBounds(const engine::utils::Rect& world_bounds) { world_bounds_ = world_bounds; }   ///< @brief 设置世界边界
         const std::optional<engine::utils::Rect>& getWorldBounds() const { return world_bounds_; }       ///< @brief 获取世界边界
+        /// @brief 启用固定步长模式。step 为每个物理步的时长（秒），max_substeps 为每帧最多执行的子步数
+        void setFixedTimestep(float step, int max_substeps);
+        void disableFixedTimestep();                                        ///< @brief 关闭固定步长模式，直接使用每帧的 delta_time
+        const std::optional<float>& getFixedTimestep() const { return fixed_timestep_; }   ///< @brief 获取固定步长（空值表示未启用）
+        float getInterpolationAlpha() const { return interpolation_alpha_; }///< @brief 获取渲染插值系数 [0, 1]，未启用固定步长时为1
+        int getLastSubstepCount() const { return last_substeps_; }          ///< @brief 获取上一次 update 执行的子步数
+        void setSleepEnabled(bool enabled);                                 ///< @brief 设置是否允许刚体休眠（关闭时唤醒所有刚体）
+        bool isSleepEnabled() const { return sleep_enabled_; }              ///< @brief 获取是否允许刚体休眠
+        void setSleepVelocityThreshold(float threshold) { sleep_velocity_threshold_ = threshold; }  ///< @brief 设置休眠速度阈值
+        float getSleepVelocityThreshold() const { return sleep_velocity_threshold_; }               ///< @brief 获取休眠速度阈值
+        void setSleepFrames(int frames) { sleep_frames_ = frames; }         ///< @brief 设置进入休眠所需的静止帧数
+        int getSleepFrames() const { return sleep_frames_; }                ///< @brief 获取进入休眠所需的静止帧数
+        size_t getAwakeBodyCount() const { return awake_body_count_; }      ///< @brief 获取清醒的刚体数量（上一次 update 统计）
+        size_t getSleepingBodyCount() const { return sleeping_body_count_; }///< @brief 获取休眠的刚体数量（上一次 update 统计）
+        /**
+         * @brief 设置每帧临时结果（碰撞对、瓦片触发事件）使用的分配器，通常为 Context 的 FrameArena。
+         * @note 分配器必须在每帧开始（调用 update 之前）重置，不设置时使用默认分配器。
+         */
+        void setFrameResource(std::pmr::memory_resource* resource);
+        /// @brief 设置每帧计数器注册表（通常为 Context 的 FrameCounters），并注册物理引擎的计数器。传入 nullptr 则不再计数
+        void setFrameCounters(engine::core::FrameCounters* counters);
+        /// @brief 设置宽阶段网格尺寸（像素）。不设置时根据碰撞瓦片层的瓦片尺寸自动计算
+        void setBroadphaseCellSize(const glm::vec2& cell_size) { broadphase_cell_size_ = cell_size; }
+        glm::vec2 getBroadphaseCellSize() const;                    ///< @brief 获取当前实际使用的宽阶段网格尺寸
         /// @brief 获取本帧检测到的所有 GameObject 碰撞对。(此列表在每次 update 开始时清空)
-        const std::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>>& getCollisionPairs() const {
+        const std::pmr::vector<std::pair<engine::object::GameObject*, engine::object::GameObject*>>& getCollisionPairs() const {
             return collision_pairs_;
         };
         /// @brief 获取本帧检测到的所有瓦片触发事件。(此列表在每次 update 开始时清空)
-        const std::vector<std::pair<engine::object::GameObject*, engine::component::TileType>>& getTileTriggerEvents() const {
+        const std::pmr::vector<std::pair<engine::object::GameObject*, engine::component::TileType>>& getTileTriggerEvents() const {
             return tile_trigger_events_;
         };
 
     private:
+        void step(float delta_time);        ///< @brief 执行一个物理步：积分、碰撞处理、休眠与触发检测
+        void savePreviousPositions();       ///< @brief 记录所有刚体当前位置作为插值的上一状态
+        void addCollisionPair(engine::object::GameObject* a, engine::object::GameObject* b);        ///< @brief 添加碰撞对（本帧已存在则忽略）
+        void addTileTriggerEvent(engine::object::GameObject* obj, engine::component::TileType type); ///< @brief 添加瓦片触发事件（本帧已存在则忽略）
+
+        /**
+         * @brief 宽阶段：把所有有效碰撞器放入均匀网格，找出共享网格的候选碰撞对。
+         * @note 结果存入 broadphase_pairs_，按 (i, j) 升序排列且已去重，与原先两层循环的遍历顺序一致。
+         */
+        void buildBroadphasePairs();
         void checkObjectCollisions();       ///< @brief 检测并处理对象之间的碰撞，并记录需要游戏逻辑处理的碰撞对。
-        /// @brief 检测并处理游戏对象和瓦片层之间的碰撞。
-        void resolveTileCollisions(engine::component::PhysicsComponent* pc, float delta_time);
+        /**
+         * @brief 检测并处理游戏对象和瓦片层之间的碰撞。
+         * @note 连续碰撞检测：按轴分离，沿位移方向逐列/逐行遍历经过的瓦片 (DDA)，停在第一个阻挡瓦片处，
+         *       因此任意大的 delta_time 都不会穿过瓦片。
+         */
+        void resolveTileCollisions(PhysicsBody& body, float delta_time);
         /// @brief 处理可移动物体与SOLID物体的碰撞。
-        void resolveSolidObjectCollisions(engine::object::GameObject* move_obj, engine::object::GameObject* solid_obj);
-        void applyWorldBounds(engine::component::PhysicsComponent* pc);     ///< @brief 应用世界边界，限制物体移动范围
+        void resolveSolidObjectCollisions(PhysicsBody& move_body, const PhysicsBody& solid_body);
+        void applyWorldBounds(PhysicsBody& body);   ///< @brief 应用世界边界，限制物体移动范围
+        /// @brief 更新刚体的休眠状态：着地且静止足够帧数的刚体进入休眠，并统计清醒/休眠数量。(碰撞处理完毕后调用)
+        void updateSleepStates();
+        void wakeOnContact(PhysicsBody& body, const PhysicsBody& other);   ///< @brief 如果 body 休眠而 other 清醒且在运动，则唤醒 body
+        static PhysicsBody makeBody(engine::component::PhysicsComponent* component);  ///< @brief 根据物理组件构建刚体记录
+        /// @brief 累加每帧计数器（未设置注册表时忽略）。热循环中应先在局部累计，再一次性调用
+        void addFrameCounter(engine::core::CounterId id, std::uint64_t amount) {
+            if (frame_counters_) frame_counters_->add(id, amount);
+        }
 
         /**
          * @brief 根据瓦片类型和指定宽度x坐标，计算瓦片上对应y坐标。
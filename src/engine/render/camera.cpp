@@ -1,13 +1,14 @@
 #include "camera.h"
 #include "../utils/math.h"
 #include "../component/transform_component.h"
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::render {
 
     Camera::Camera(const glm::vec2& viewport_size, const glm::vec2& position, const std::optional<engine::utils::Rect> limit_bounds)
         : viewport_size_(viewport_size), position_(position), limit_bounds_(limit_bounds) {
-        spdlog::trace("Camera 初始化成功，位置: {},{}", position_.x, position_.y);
+        ENGINE_LOG_TRACE("Camera 初始化成功，位置: {},{}", position_.x, position_.y);
     }
 
     void Camera::setPosition(const glm::vec2& position) {
@@ -15,10 +16,10 @@ namespace engine::render {
         clampPosition();
     }
 
-    void Camera::update(float delta_time)
+    void Camera::update(float delta_time, float interpolation_alpha)
     {
         if (target_ == nullptr)  return;
-        glm::vec2 target_pos = target_->getPosition();
+        glm::vec2 target_pos = target_->getInterpolatedPosition(interpolation_alpha);  // 跟随渲染时的插值位置，避免与精灵产生抖动
         glm::vec2 desired_position = target_pos - viewport_size_ / 2.0f;      // 计算目标位置 (让目标位于视口中心)
 
         // 计算当前位置与目标位置的距离
@@ -24,7 +24,7 @@ namespace engine::render {
 
         Camera(const glm::vec2& viewport_size, const glm::vec2& position = glm::vec2(0.0f, 0.0f), const std::optional<engine::utils::Rect> limit_bounds = std::nullopt);
 
-        void update(float delta_time);                                          ///< @brief 更新相机位置
+        void update(float delta_time, float interpolation_alpha = 1.0f);       ///< @brief 更新相机位置 (跟随目标的插值位置，alpha 见 PhysicsEngine::getInterpolationAlpha)
         void move(const glm::vec2& offset);                                     ///< @brief 移动相机
 
         glm::vec2 worldToScreen(const glm::vec2& world_pos) const;              ///< @brief 世界坐标转屏幕坐标
@@ -0,0 +1,59 @@
+#include "frame_counters_overlay.h"
+#include "renderer.h"
+#include "../core/frame_counters.h"
+#include <SDL3/SDL.h>
+#include <spdlog/fmt/fmt.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace engine::render {
+
+    void FrameCountersOverlay::render(Renderer& renderer, const engine::core::FrameCounters& counters) const {
+        const auto& list = counters.getCounters();
+        if (!visible_ || list.empty()) return;
+
+        renderer.flush();       // 下面直接调用 SDL 绘制函数，先提交批处理内容
+        SDL_Renderer* sdl_renderer = renderer.getSDLRenderer();
+
+        constexpr float margin = 4.0f;
+        constexpr float char_size = static_cast<float>(SDL_DEBUG_TEXT_FONT_CHARACTER_SIZE);
+        constexpr float line_height = char_size + 2.0f;
+
+        // 名称左对齐、数值右对齐，按最长的名称决定列宽
+        size_t name_width = 0;
+        for (const auto& counter : list) {
+            name_width = std::max(name_width, counter.name.size());
+        }
+        std::vector<std::string> lines;
+        lines.reserve(list.size());
+        size_t line_width = 0;
+        for (const auto& counter : list) {
+            lines.push_back(fmt::format("{:<{}} {:>8}", counter.name, name_width, counter.last_value));
+            line_width = std::max(line_width, lines.back().size());
+        }
+
+        // 绘制后恢复原来的绘制颜色和混合模式（清屏使用）
+        Uint8 r, g, b, a;
+        SDL_BlendMode blend_mode = SDL_BLENDMODE_NONE;
+        SDL_GetRenderDrawColor(sdl_renderer, &r, &g, &b, &a);
+        SDL_GetRenderDrawBlendMode(sdl_renderer, &blend_mode);
+
+        // 半透明背景，保证在任何画面上都能看清
+        const SDL_FRect background = { 0.0f, 0.0f, line_width * char_size + margin * 2.0f, lines.size() * line_height + margin * 2.0f };
+        SDL_SetRenderDrawBlendMode(sdl_renderer, SDL_BLENDMODE_BLEND);
+        SDL_SetRenderDrawColor(sdl_renderer, 0, 0, 0, 160);
+        SDL_RenderFillRect(sdl_renderer, &background);
+
+        SDL_SetRenderDrawColor(sdl_renderer, 255, 255, 255, 255);
+        float y = margin;
+        for (const auto& line : lines) {
+            SDL_RenderDebugText(sdl_renderer, margin, y, line.c_str());
+            y += line_height;
+        }
+
+        SDL_SetRenderDrawBlendMode(sdl_renderer, blend_mode);
+        SDL_SetRenderDrawColor(sdl_renderer, r, g, b, a);
+    }
+
+} // namespace engine::render
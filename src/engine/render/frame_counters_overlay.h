@@ -0,0 +1,36 @@
+#pragma once
+
+namespace engine::core {
+    class FrameCounters;
+}
+
+namespace engine::render {
+    class Renderer;
+
+    /**
+     * @brief 在屏幕左上角显示上一帧所有计数器（FrameCounters）的调试叠加层。
+     *
+     * 使用 SDL 内置的调试字体绘制，不依赖任何字体或纹理资源。默认隐藏。
+     */
+    class FrameCountersOverlay final {
+    private:
+        bool visible_ = false;      ///< @brief 是否显示
+
+    public:
+        explicit FrameCountersOverlay(bool visible = false) : visible_(visible) {}
+
+        // 禁止拷贝和移动
+        FrameCountersOverlay(const FrameCountersOverlay&) = delete;
+        FrameCountersOverlay& operator=(const FrameCountersOverlay&) = delete;
+        FrameCountersOverlay(FrameCountersOverlay&&) = delete;
+        FrameCountersOverlay& operator=(FrameCountersOverlay&&) = delete;
+
+        /// @brief 绘制叠加层（隐藏时不做任何事）。应在场景渲染之后、present 之前调用
+        void render(Renderer& renderer, const engine::core::FrameCounters& counters) const;
+
+        void setVisible(bool visible) { visible_ = visible; }   ///< @brief 设置是否显示
+        void toggle() { visible_ = !visible_; }                 ///< @brief 切换显示/隐藏
+        bool isVisible() const { return visible_; }             ///< @brief 是否显示
+    };
+
+} // namespace engine::render
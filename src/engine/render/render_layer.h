@@ -0,0 +1,22 @@
+#pragma once
+
+namespace engine::render {
+
+    /**
+     * @brief 游戏对象的渲染层（z 值），决定场景中对象之间的绘制先后。
+     *
+     * Scene::render 把每个对象的渲染层映射为 Renderer 的渲染层：层值小的先绘制，
+     * 同一层内的精灵在批处理时按纹理排序合并，不保证先后顺序。
+     * 各层之间留有间隔，可用 GameObject::setRenderLayer 的 order 参数在层内再细分（例如关卡的多个图层）。
+     */
+    enum class RenderLayer : int {
+        BACKGROUND = 0,     ///< @brief 背景（视差图层等）
+        TILES = 100,        ///< @brief 关卡图层（瓦片、对象图层按地图中的顺序依次 +1）
+        ACTORS = 1000,      ///< @brief 角色、道具等（代码创建的对象默认在此层）
+        EFFECTS = 1100,     ///< @brief 特效
+    };
+
+    /// @brief 一个场景占用的渲染层跨度：场景绘制完后 Renderer 的渲染层前进这么多，使之后绘制的内容（叠加场景、UI）位于其上
+    inline constexpr int SCENE_RENDER_LAYER_SPAN = 1200;
+
+} // namespace engine::render
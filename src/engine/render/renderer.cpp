@@ -2,8 +2,12 @@
 #include "../resource/resource_manager.h"
 #include "camera.h"
 #include "sprite.h"
+#include "../core/profiler.h"
 #include <SDL3/SDL.h>
 #include <stdexcept> // For std::runtime_error
+#include <algorithm>
+#include <cmath>
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::render {
@@ -12,7 +16,7 @@ namespace engine::render {
     Renderer::Renderer(SDL_Renderer* sdl_renderer, engine::resource::ResourceManager* resource_manager)
         : renderer_(sdl_renderer), resource_manager_(resource_manager)
     {
-        spdlog::trace("构造 Renderer...");
+        ENGINE_LOG_TRACE("构造 Renderer...");
         if (!renderer_) {
             throw std::runtime_error("Renderer 构造失败: 提供的 SDL_Renderer 指针为空。");
         }
@@ -21,19 +25,20 @@ namespace engine::render {
             throw std::runtime_error("Renderer 构造失败: 提供的 ResourceManager 指针为空。");
         }
         setDrawColor(0, 0, 0, 255);
-        spdlog::trace("Renderer 构造成功。");
+        ENGINE_LOG_TRACE("Renderer 构造成功。");
     }
 
     void Renderer::drawSprite(const Camera& camera, const Sprite& sprite, const glm::vec2& position, const glm::vec2& scale, double angle) {
-        auto texture = resource_manager_->getTexture(sprite.getTextureId());
+        ENGINE_PROFILE_SCOPE("Renderer::drawSprite");
+        auto texture = resolveTexture(sprite);
         if (!texture) {
-            spdlog::error("无法为 ID {} 获取纹理。", sprite.getTextureId());
+            spdlog::error("无法为 ID {} 获取纹理。", getTextureId(sprite));
             return;
         }
 
         auto src_rect = getSpriteSrcRect(sprite);
         if (!src_rect.has_value()) {
-            spdlog::error("无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
+            spdlog::error("无法获取精灵的源矩形，ID: {}", getTextureId(sprite));
             return;
         }
 
@@ -51,27 +56,28 @@ namespace engine::render {
         };
 
         if (!isRectInViewport(camera, dest_rect)) { // 视口裁剪：如果精灵超出视口，则不绘制
-            // spdlog::info("精灵超出视口范围，ID: {}", sprite.getTextureId());
+            // spdlog::info("精灵超出视口范围，ID: {}", getTextureId(sprite));
+            addFrameCounter(counter_ids_.sprites_culled);
             return;
         }
 
         // 执行绘制(默认旋转中心为精灵的中心点)
-        if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect.value(), &dest_rect, angle, NULL, sprite.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
-            spdlog::error("渲染旋转纹理失败（ID: {}）：{}", sprite.getTextureId(), SDL_GetError());
+        if (!submitQuad(texture, src_rect.value(), dest_rect, angle, sprite.isFlipped())) {
+            spdlog::error("渲染旋转纹理失败（ID: {}）：{}", getTextureId(sprite), SDL_GetError());
         }
     }
 
     void Renderer::drawParallax(const Camera& camera, const Sprite& sprite, const glm::vec2& position, const glm::vec2& scroll_factor, const glm::bvec2& repeat, const glm::vec2& scale)
     {
-        auto texture = resource_manager_->getTexture(sprite.getTextureId());
+        auto texture = resolveTexture(sprite);
         if (!texture) {
-            spdlog::error("无法为 ID {} 获取纹理。", sprite.getTextureId());
+            spdlog::error("无法为 ID {} 获取纹理。", getTextureId(sprite));
             return;
         }
 
         auto src_rect = getSpriteSrcRect(sprite);
         if (!src_rect.has_value()) {
-            spdlog::error("无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
+            spdlog::error("无法获取精灵的源矩形，ID: {}", getTextureId(sprite));
             return;
         }
 
@@ -103,11 +109,14 @@ namespace engine::render {
             stop.y = glm::min(position_screen.y + scaled_tex_h, viewport_size.y); // 结束点是一个纹理高度之后，但不超过视口高度
         }
 
+        // 视差背景绘制整张纹理 (尺寸在加载时已缓存)
+        glm::vec2 texture_size = resource_manager_->getTextureSize(sprite.getTextureHandle());
+        SDL_FRect full_rect = { 0, 0, texture_size.x, texture_size.y };
         for (float y = start.y; y < stop.y; y += scaled_tex_h) {
             for (float x = start.x; x < stop.x; x += scaled_tex_w) {
                 SDL_FRect dest_rect = { x, y, scaled_tex_w, scaled_tex_h };
-                if (!SDL_RenderTexture(renderer_, texture, nullptr, &dest_rect)) {
-                    spdlog::error("渲染视差纹理失败（ID: {}）：{}", sprite.getTextureId(), SDL_GetError());
+                if (!submitQuad(texture, full_rect, dest_rect, 0.0, false)) {
+                    spdlog::error("渲染视差纹理失败（ID: {}）：{}", getTextureId(sprite), SDL_GetError());
                     return;
                 }
             }
@@ -115,15 +124,15 @@ namespace engine::render {
     }
 
     void Renderer::drawUISprite(const Sprite& sprite, const glm::vec2& position, const std::optional<glm::vec2>& size) {
-        auto texture = resource_manager_->getTexture(sprite.getTextureId());
+        auto texture = resolveTexture(sprite);
         if (!texture) {
-            spdlog::error("无法为 ID {} 获取纹理。", sprite.getTextureId());
+            spdlog::error("无法为 ID {} 获取纹理。", getTextureId(sprite));
             return;
         }
 
         auto src_rect = getSpriteSrcRect(sprite);
         if (!src_rect.has_value()) {
-            spdlog::error("无法获取精灵的源矩形，ID: {}", sprite.getTextureId());
+            spdlog::error("无法获取精灵的源矩形，ID: {}", getTextureId(sprite));
             return;
         }
 
@@ -138,11 +147,82 @@ namespace engine::render {
         }
 
         // 执行绘制(未考虑UI旋转)
-        if (!SDL_RenderTextureRotated(renderer_, texture, &src_rect.value(), &dest_rect, 0.0, nullptr, sprite.isFlipped() ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE)) {
-            spdlog::error("渲染 UI Sprite 失败 (ID: {}): {}", sprite.getTextureId(), SDL_GetError());
+        if (!submitQuad(texture, src_rect.value(), dest_rect, 0.0, sprite.isFlipped())) {
+            spdlog::error("渲染 UI Sprite 失败 (ID: {}): {}", getTextureId(sprite), SDL_GetError());
         }
     }
 
+    void Renderer::drawTexture(const Camera& camera, SDL_Texture* texture, const glm::vec2& position, const glm::vec2& size)
+    {
+        if (!texture) return;
+
+        // 应用相机变换
+        glm::vec2 position_screen = camera.worldToScreen(position);
+        SDL_FRect dest_rect = { position_screen.x, position_screen.y, size.x, size.y };
+        if (!isRectInViewport(camera, dest_rect)) {         // 视口裁剪
+            addFrameCounter(counter_ids_.sprites_culled);
+            return;
+        }
+
+        SDL_FRect src_rect = { 0, 0, 0, 0 };
+        if (!SDL_GetTextureSize(texture, &src_rect.w, &src_rect.h)) {
+            spdlog::error("无法获取纹理尺寸：{}", SDL_GetError());
+            return;
+        }
+        if (!submitQuad(texture, src_rect, dest_rect, 0.0, false)) {
+            spdlog::error("渲染纹理失败：{}", SDL_GetError());
+        }
+    }
+
+    SDL_Texture* Renderer::createRenderTarget(int width, int height)
+    {
+        SDL_Texture* texture = SDL_CreateTexture(renderer_, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, width, height);
+        if (!texture) {
+            spdlog::error("创建渲染目标纹理失败 ({}x{})：{}", width, height, SDL_GetError());
+            return nullptr;
+        }
+        // 与普通纹理一致使用最邻近插值
+        if (!SDL_SetTextureScaleMode(texture, SDL_SCALEMODE_NEAREST)) {
+            spdlog::warn("无法设置渲染目标纹理的缩放模式为最邻近插值");
+        }
+        // 内容是以 BLEND 模式绘制到全透明背景上的，颜色已乘过 Alpha（预乘），合成时不能再乘一次，否则半透明像素会变暗
+        if (!SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED)) {
+            spdlog::warn("无法设置渲染目标纹理的混合模式：{}", SDL_GetError());
+        }
+        return texture;
+    }
+
+    bool Renderer::beginRenderTarget(SDL_Texture* target)
+    {
+        if (in_render_target_) {
+            spdlog::error("beginRenderTarget 不支持嵌套调用。");
+            return false;
+        }
+        flush();    // 先提交已收集的内容，它们属于原渲染目标
+        previous_target_ = SDL_GetRenderTarget(renderer_);
+        SDL_GetRenderDrawColor(renderer_, &previous_color_[0], &previous_color_[1], &previous_color_[2], &previous_color_[3]);
+        if (!SDL_SetRenderTarget(renderer_, target)) {
+            spdlog::error("切换渲染目标失败：{}", SDL_GetError());
+            return false;
+        }
+        in_render_target_ = true;
+        // 清空为全透明
+        setDrawColor(0, 0, 0, 0);
+        clearScreen();
+        return true;
+    }
+
+    void Renderer::endRenderTarget()
+    {
+        if (!in_render_target_) return;
+        if (!SDL_SetRenderTarget(renderer_, previous_target_)) {
+            spdlog::error("恢复渲染目标失败：{}", SDL_GetError());
+        }
+        setDrawColor(previous_color_[0], previous_color_[1], previous_color_[2], previous_color_[3]);
+        previous_target_ = nullptr;
+        in_render_target_ = false;
+    }
+
     void Renderer::setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a) {
         if (!SDL_SetRenderDrawColor(renderer_, r, g, b, a)) {
             spdlog::error("设置渲染绘制颜色失败：{}", SDL_GetError());
@@ -164,32 +244,150 @@ namespace engine::render {
 
     void Renderer::present()
     {
+        flush();
+        render_layer_ = 0;
+        last_drawn_texture_ = nullptr;
         SDL_RenderPresent(renderer_);
     }
 
-    std::optional<SDL_FRect> Renderer::getSpriteSrcRect(const Sprite& sprite)
+    void Renderer::setBatchingEnabled(bool enabled)
     {
-        SDL_Texture* texture = resource_manager_->getTexture(sprite.getTextureId());
-        if (!texture) {
-            spdlog::error("无法为 ID {} 获取纹理。", sprite.getTextureId());
-            return std::nullopt;
+        if (batching_enabled_ && !enabled) {
+            flush();
         }
+        batching_enabled_ = enabled;
+        ENGINE_LOG_TRACE("Renderer 批处理模式: {}", batching_enabled_);
+    }
 
+    void Renderer::setFrameCounters(engine::core::FrameCounters* counters)
+    {
+        frame_counters_ = counters;
+        if (!frame_counters_) return;
+        counter_ids_.draw_calls = frame_counters_->registerCounter("renderer.draw_calls");
+        counter_ids_.texture_switches = frame_counters_->registerCounter("renderer.texture_switches");
+        counter_ids_.sprites_culled = frame_counters_->registerCounter("renderer.sprites_culled");
+    }
+
+    bool Renderer::submitQuad(SDL_Texture* texture, const SDL_FRect& src, const SDL_FRect& dest, double angle, bool flipped)
+    {
+        // 向纹理渲染（烘焙）时需要立即绘制
+        if (!batching_enabled_ || in_render_target_) {
+            countDrawCall(texture);
+            return SDL_RenderTextureRotated(renderer_, texture, &src, &dest, angle, nullptr, flipped ? SDL_FLIP_HORIZONTAL : SDL_FLIP_NONE);
+        }
+        batch_quads_.push_back({ render_layer_, texture, src, dest, static_cast<float>(angle), flipped });
+        return true;
+    }
+
+    void Renderer::flush()
+    {
+        last_flush_draw_calls_ = 0;
+        if (batch_quads_.empty()) return;
+
+        // 先按渲染层，再按纹理排序 (稳定排序：同层同纹理的四边形保持提交顺序)
+        std::stable_sort(batch_quads_.begin(), batch_quads_.end(), [](const BatchQuad& a, const BatchQuad& b) {
+            if (a.layer != b.layer) return a.layer < b.layer;
+            return std::less<SDL_Texture*>()(a.texture, b.texture);
+        });
+
+        const SDL_FColor white = { 1.0f, 1.0f, 1.0f, 1.0f };
+        for (size_t begin = 0; begin < batch_quads_.size();) {
+            // 找出使用同一纹理的连续四边形（跨渲染层也可以合并，因为顺序不变）
+            auto* texture = batch_quads_[begin].texture;
+            auto end = begin + 1;
+            while (end < batch_quads_.size() && batch_quads_[end].texture == texture) {
+                ++end;
+            }
+
+            float tex_w = 0.0f, tex_h = 0.0f;
+            if (!SDL_GetTextureSize(texture, &tex_w, &tex_h) || tex_w <= 0.0f || tex_h <= 0.0f) {
+                spdlog::error("批处理提交时无法获取纹理尺寸：{}", SDL_GetError());
+                begin = end;
+                continue;
+            }
+
+            batch_vertices_.clear();
+            batch_indices_.clear();
+            for (auto i = begin; i < end; ++i) {
+                const auto& quad = batch_quads_[i];
+                // 纹理坐标（归一化），水平翻转时交换左右
+                float u0 = quad.src.x / tex_w, u1 = (quad.src.x + quad.src.w) / tex_w;
+                float v0 = quad.src.y / tex_h, v1 = (quad.src.y + quad.src.h) / tex_h;
+                if (quad.flipped) std::swap(u0, u1);
+
+                // 四个角相对中心的偏移（左上、右上、右下、左下），绕中心旋转（屏幕坐标 y 向下，正角度为顺时针）
+                glm::vec2 center = { quad.dest.x + quad.dest.w * 0.5f, quad.dest.y + quad.dest.h * 0.5f };
+                glm::vec2 half = { quad.dest.w * 0.5f, quad.dest.h * 0.5f };
+                glm::vec2 corners[4] = { { -half.x, -half.y }, { half.x, -half.y }, { half.x, half.y }, { -half.x, half.y } };
+                if (quad.angle != 0.0f) {
+                    float radians = glm::radians(quad.angle);
+                    float c = std::cos(radians), s = std::sin(radians);
+                    for (auto& corner : corners) {
+                        corner = { corner.x * c - corner.y * s, corner.x * s + corner.y * c };
+                    }
+                }
+                const SDL_FPoint uvs[4] = { { u0, v0 }, { u1, v0 }, { u1, v1 }, { u0, v1 } };
+
+                auto base = static_cast<int>(batch_vertices_.size());
+                for (int k = 0; k < 4; ++k) {
+                    batch_vertices_.push_back({ { center.x + corners[k].x, center.y + corners[k].y }, white, uvs[k] });
+                }
+                for (int offset : { 0, 1, 2, 0, 2, 3 }) {
+                    batch_indices_.push_back(base + offset);
+                }
+            }
+
+            if (!SDL_RenderGeometry(renderer_, texture, batch_vertices_.data(), static_cast<int>(batch_vertices_.size()),
+                batch_indices_.data(), static_cast<int>(batch_indices_.size()))) {
+                spdlog::error("批处理提交失败：{}", SDL_GetError());
+            }
+            ++last_flush_draw_calls_;
+            countDrawCall(texture);
+            begin = end;
+        }
+        batch_quads_.clear();
+    }
+
+    void Renderer::countDrawCall(SDL_Texture* texture)
+    {
+        addFrameCounter(counter_ids_.draw_calls);
+        if (texture != last_drawn_texture_) {
+            addFrameCounter(counter_ids_.texture_switches);
+            last_drawn_texture_ = texture;
+        }
+    }
+
+    SDL_Texture* Renderer::resolveTexture(const Sprite& sprite)
+    {
+        auto handle = sprite.getTextureHandle();
+        if (!handle.isValid()) {
+            return nullptr;     // 创建精灵时纹理加载失败（已记录错误）
+        }
+        return resource_manager_->getTexture(handle);
+    }
+
+    const std::string& Renderer::getTextureId(const Sprite& sprite) const
+    {
+        return resource_manager_->getTexturePath(sprite.getTextureHandle());
+    }
+
+    std::optional<SDL_FRect> Renderer::getSpriteSrcRect(const Sprite& sprite)
+    {
         auto src_rect = sprite.getSourceRect();
         if (src_rect.has_value()) {     // 如果Sprite中存在指定rect，则判断尺寸是否有效
             if (src_rect.value().w <= 0 || src_rect.value().h <= 0) {
-                spdlog::error("源矩形尺寸无效，ID: {}", sprite.getTextureId());
+                spdlog::error("源矩形尺寸无效，ID: {}", getTextureId(sprite));
                 return std::nullopt;
             }
             return src_rect;
         }
-        else {                        // 否则获取纹理尺寸并返回整个纹理大小
-            SDL_FRect result = { 0, 0, 0, 0 };
-            if (!SDL_GetTextureSize(texture, &result.w, &result.h)) {
-                spdlog::error("无法获取纹理尺寸，ID: {}", sprite.getTextureId());
+        else {                        // 否则返回整个纹理大小 (使用句柄中缓存的尺寸)
+            glm::vec2 size = resource_manager_->getTextureSize(sprite.getTextureHandle());
+            if (size.x <= 0 || size.y <= 0) {
+                spdlog::error("无法获取纹理尺寸，ID: {}", getTextureId(sprite));
                 return std::nullopt;
             }
-            return result;
+            return SDL_FRect{ 0, 0, size.x, size.y };
         }
     }
 
@@ -1,11 +1,11 @@
 #pragma once
 #include "sprite.h"
+#include "../core/frame_counters.h"
 #include <string>
+#include <vector>
 #include <optional> // For std::optional
 #include <glm/glm.hpp>
-
-struct SDL_Renderer;
-struct SDL_FRect;
+#include <SDL3/SDL_render.h> // 用于 SDL_Vertex 等类型
 
 namespace engine::resource {
     class ResourceManager;
@@ -20,12 +20,51 @@ namespace engine::render {
      * 包装 SDL_Renderer 并提供清除屏幕、绘制精灵和呈现最终图像的方法。
      * 在构造时初始化。依赖于一个有效的 SDL_Renderer 和 ResourceManager。
      * 构造失败会抛出异常。
+     *
+     * 批处理模式下，绘制调用不会立即提交，而是收集为四边形，在 present()（或 flush()）时按"渲染层 -> 纹理"排序，
+     * 相同纹理的连续四边形合并为一次 SDL_RenderGeometry 调用（翻转和旋转在 CPU 端计算）。
+     * 同一渲染层内的绘制顺序不做保证，需要保证先后顺序的内容应放在不同的渲染层（见 setRenderLayer/nextRenderLayer）。
+     * 场景按游戏对象的 RenderLayer 设置渲染层，因此同一层内不同对象的精灵也能按纹理合并。
      */
     class Renderer final {
     private:
+        /// @brief 批处理模式下收集的一个待绘制四边形（屏幕坐标）
+        struct BatchQuad {
+            int layer = 0;                      ///< @brief 渲染层
+            SDL_Texture* texture = nullptr;     ///< @brief 纹理 (非拥有)
+            SDL_FRect src;                      ///< @brief 源矩形 (像素)
+            SDL_FRect dest;                     ///< @brief 目标矩形 (屏幕坐标)
+            float angle = 0.0f;                 ///< @brief 绕目标矩形中心的旋转角度（度，顺时针）
+            bool flipped = false;               ///< @brief 是否水平翻转
+        };
+
         SDL_Renderer* renderer_ = nullptr;                              ///< @brief 指向 SDL_Renderer 的非拥有指针
         engine::resource::ResourceManager* resource_manager_ = nullptr; ///< @brief 指向 ResourceManager 的非拥有指针
 
+        // --- 渲染到纹理 (beginRenderTarget/endRenderTarget 之间保存的原状态) ---
+        SDL_Texture* previous_target_ = nullptr;                        ///< @brief 切换前的渲染目标
+        Uint8 previous_color_[4] = { 0, 0, 0, 255 };                    ///< @brief 切换前的绘制颜色
+        bool in_render_target_ = false;                                 ///< @brief 是否正在向纹理渲染
+
+        // --- 批处理 ---
+        bool batching_enabled_ = false;                                 ///< @brief 是否启用批处理模式
+        int render_layer_ = 0;                                          ///< @brief 当前渲染层（每次提交后重置为0）
+        std::vector<BatchQuad> batch_quads_;                            ///< @brief 本帧收集的四边形 (容器只清空不释放)
+        std::vector<SDL_Vertex> batch_vertices_;                        ///< @brief 提交时使用的顶点缓冲
+        std::vector<int> batch_indices_;                                ///< @brief 提交时使用的索引缓冲
+        int last_flush_draw_calls_ = 0;                                 ///< @brief 上一次提交产生的 SDL_RenderGeometry 调用次数
+
+        // --- 每帧计数器 ---
+        /// @brief 注册到 FrameCounters 的计数器编号
+        struct CounterIds {
+            engine::core::CounterId draw_calls = 0;         ///< @brief SDL 绘制调用次数（批处理提交或立即绘制）
+            engine::core::CounterId texture_switches = 0;   ///< @brief 绘制调用之间切换纹理的次数
+            engine::core::CounterId sprites_culled = 0;     ///< @brief 因超出视口而跳过的精灵/纹理数量
+        };
+        engine::core::FrameCounters* frame_counters_ = nullptr;         ///< @brief 每帧计数器注册表（非拥有，可能为空）
+        CounterIds counter_ids_;                                        ///< @brief 计数器编号
+        SDL_Texture* last_drawn_texture_ = nullptr;                     ///< @brief 本帧上一次绘制调用使用的纹理（用于统计纹理切换）
+
     public:
         /**
          * @brief 构造函数
@@ -67,8 +106,44 @@ namespace engine::render {
          */
         void drawUISprite(const Sprite& sprite, const glm::vec2& position, const std::optional<glm::vec2>& size = std::nullopt);
 
+        /**
+         * @brief 在世界坐标中绘制一整张纹理（例如预先烘焙的瓦片块），会进行视口裁剪。
+         *
+         * @param texture 要绘制的纹理（非拥有）。
+         * @param position 世界坐标中的左上角位置。
+         * @param size 目标矩形的大小（像素）。
+         */
+        void drawTexture(const Camera& camera, SDL_Texture* texture, const glm::vec2& position, const glm::vec2& size);
+
+        /**
+         * @brief 创建一张可作为渲染目标的透明纹理（最邻近插值，预乘 Alpha 混合）。
+         * @return 创建的纹理，失败返回 nullptr。调用者负责使用 SDL_DestroyTexture 释放。
+         */
+        SDL_Texture* createRenderTarget(int width, int height);
 
-        void present();                                                     ///< @brief 更新屏幕，包装 SDL_RenderPresent 函数
+        /**
+         * @brief 开始向纹理渲染：保存当前渲染目标和绘制颜色，切换到 target 并清空为透明。
+         *
+         * 之后的 drawUISprite 等调用会以纹理左上角为原点绘制。必须与 endRenderTarget 配对使用，不支持嵌套。
+         * @return 切换成功返回 true。
+         */
+        bool beginRenderTarget(SDL_Texture* target);
+        void endRenderTarget();                                             ///< @brief 结束向纹理渲染，恢复之前的渲染目标和绘制颜色
+
+
+        // --- 批处理 ---
+        void setBatchingEnabled(bool enabled);                              ///< @brief 设置是否启用批处理模式（关闭前会先提交已收集的内容）
+        bool isBatchingEnabled() const { return batching_enabled_; }        ///< @brief 获取是否启用批处理模式
+        void nextRenderLayer() { ++render_layer_; }                         ///< @brief 之后的绘制进入新的渲染层（绘制在之前所有层之上）
+        void setRenderLayer(int layer) { render_layer_ = layer; }           ///< @brief 设置之后绘制使用的渲染层（值大的层绘制在上面）
+        int getRenderLayer() const { return render_layer_; }                ///< @brief 获取当前渲染层
+        /// @brief 提交批处理中收集的所有四边形。直接调用 SDL 绘制函数（例如调试文字）之前需要先调用，以保证绘制顺序
+        void flush();
+        int getLastFlushDrawCalls() const { return last_flush_draw_calls_; }///< @brief 获取上一次提交的绘制调用次数
+        /// @brief 设置每帧计数器注册表（通常为 Context 的 FrameCounters），并注册渲染器的计数器。传入 nullptr 则不再计数
+        void setFrameCounters(engine::core::FrameCounters* counters);
+
+        void present();                                                     ///< @brief 提交批处理内容并更新屏幕，包装 SDL_RenderPresent 函数
         void clearScreen();                                                 ///< @brief 清屏，包装 SDL_RenderClear 函数
 
         void setDrawColor(Uint8 r, Uint8 g, Uint8 b, Uint8 a = 255);        ///< @brief 设置绘制颜色，包装 SDL_SetRenderDrawColor 函数，使用 Uint8 类型
@@ -83,8 +158,18 @@ namespace engine::render {
         Renderer& operator=(Renderer&&) = delete;
 
     private:
-        std::optional<SDL_FRect> getSpriteSrcRect(const Sprite& sprite);     ///< @brief 获取精灵的源矩形，用于具体绘制。出现错误则返回std::nullopt并跳过绘制
+        /// @brief 通过精灵的纹理句柄获取纹理（已卸载则重新加载）。句柄无效或加载失败返回 nullptr
+        SDL_Texture* resolveTexture(const Sprite& sprite);
+        const std::string& getTextureId(const Sprite& sprite) const;         ///< @brief 获取精灵纹理的文件路径（仅用于日志）
+        /// @brief 获取精灵的源矩形，用于具体绘制 (需先调用 resolveTexture)。出现错误则返回std::nullopt并跳过绘制
+        std::optional<SDL_FRect> getSpriteSrcRect(const Sprite& sprite);
         bool isRectInViewport(const Camera& camera, const SDL_FRect& rect);  ///< @brief 判断矩形是否在视口中，用于视口裁剪
+        /// @brief 绘制一个纹理四边形：批处理模式下加入批次，否则（或正在向纹理渲染时）立即绘制。成功返回 true
+        bool submitQuad(SDL_Texture* texture, const SDL_FRect& src, const SDL_FRect& dest, double angle, bool flipped);
+        void countDrawCall(SDL_Texture* texture);                           ///< @brief 统计一次绘制调用（以及纹理切换）
+        void addFrameCounter(engine::core::CounterId id, std::uint64_t amount = 1) {   ///< @brief 累加每帧计数器（未设置注册表时忽略）
+            if (frame_counters_) frame_counters_->add(id, amount);
+        }
 
     };
 
@@ -0,0 +1,14 @@
+#include "sprite.h"
+#include "../resource/resource_manager.h"
+
+namespace engine::render {
+
+    Sprite::Sprite(engine::resource::ResourceManager& resource_manager, const std::string& texture_id,
+                   const std::optional<SDL_FRect>& source_rect, bool is_flipped)
+        : texture_handle_(resource_manager.getTextureHandle(texture_id)),
+        source_rect_(source_rect),
+        is_flipped_(is_flipped)
+    {
+    }
+
+} // namespace engine::render
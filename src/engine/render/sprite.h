@@ -2,21 +2,27 @@
 #include <SDL3/SDL_rect.h>   // 用于 SDL_FRect
 #include <optional>          // 用于 std::optional 表示可选的源矩形
 #include <string>
+#include "../resource/texture_handle.h"
+
+namespace engine::resource {
+    class ResourceManager;
+}
 
 namespace engine::render {
 
     /**
      * @brief 表示要绘制的视觉精灵的数据。
      *
-     * 包含纹理标识符、要绘制的纹理部分（源矩形）以及翻转状态。
+     * 包含纹理句柄、要绘制的纹理部分（源矩形）以及翻转状态。
+     * 纹理句柄在创建精灵时通过 ResourceManager 由文件路径换取，绘制时直接使用，精灵本身不保存路径字符串（拷贝开销很小）。
      * 位置、缩放和旋转由外部（例如 SpriteComponent）标识。
      * 渲染工作由 Renderer 类完成。（传入Sprite作为参数）
      */
     class Sprite final {
     private:
-        std::string texture_id_;                      ///< @brief 纹理资源的标识符
-        std::optional<SDL_FRect> source_rect_;        ///< @brief 可选：要绘制的纹理部分
-        bool is_flipped_ = false;                     ///< @brief 是否水平翻转
+        engine::resource::TextureHandle texture_handle_;    ///< @brief 纹理句柄
+        std::optional<SDL_FRect> source_rect_;              ///< @brief 可选：要绘制的纹理部分
+        bool is_flipped_ = false;                           ///< @brief 是否水平翻转
 
     public:
         /**
@@ -27,23 +33,34 @@ namespace engine::render {
         /**
          * @brief 构造一个精灵
          *
-         * @param texture_id 纹理资源的标识符。不应为空。
+         * @param texture_handle 纹理句柄（由 ResourceManager::getTextureHandle 获取）
          * @param source_rect 可选的源矩形（SDL_FRect），定义要使用的纹理部分。如果为 std::nullopt，则使用整个纹理。
          * @param is_flipped 是否水平翻转
          */
-        Sprite(const std::string& texture_id, const std::optional<SDL_FRect>& source_rect = std::nullopt, bool is_flipped = false)
-            : texture_id_(texture_id),
+        explicit Sprite(engine::resource::TextureHandle texture_handle, const std::optional<SDL_FRect>& source_rect = std::nullopt, bool is_flipped = false)
+            : texture_handle_(texture_handle),
             source_rect_(source_rect),
             is_flipped_(is_flipped)
         {
         }
 
+        /**
+         * @brief 根据纹理路径构造一个精灵（慢速路径：通过 ResourceManager 查找句柄，纹理未加载时会加载）
+         *
+         * @param resource_manager 资源管理器
+         * @param texture_id 纹理资源的标识符（文件路径）。不应为空。
+         * @param source_rect 可选的源矩形，如果为 std::nullopt，则使用整个纹理。
+         * @param is_flipped 是否水平翻转
+         */
+        Sprite(engine::resource::ResourceManager& resource_manager, const std::string& texture_id,
+               const std::optional<SDL_FRect>& source_rect = std::nullopt, bool is_flipped = false);
+
         // --- getters and setters ---
-        const std::string& getTextureId() const { return texture_id_; }                                     ///< @brief 获取纹理 ID
+        engine::resource::TextureHandle getTextureHandle() const { return texture_handle_; }               ///< @brief 获取纹理句柄 (纹理加载失败时无效)
         const std::optional<SDL_FRect>& getSourceRect() const { return source_rect_; }                      ///< @brief 获取源矩形 (如果使用整个纹理则为 std::nullopt)
         bool isFlipped() const { return is_flipped_; }                                                      ///< @brief 获取是否水平翻转
 
-        void setTextureId(const std::string& texture_id) { texture_id_ = texture_id; }                      ///< @brief 设置纹理 ID
+        void setTextureHandle(engine::resource::TextureHandle texture_handle) { texture_handle_ = texture_handle; }  ///< @brief 设置纹理句柄
         void setSourceRect(const std::optional<SDL_FRect>& source_rect) { source_rect_ = source_rect; }     ///< @brief 设置源矩形 (如果使用整个纹理则为 std::nullopt)
         void setFlipped(bool flipped) { is_flipped_ = flipped; }                                            ///< @brief 设置是否水平翻转
 
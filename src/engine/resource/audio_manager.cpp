@@ -1,4 +1,5 @@
 #include "audio_manager.h"
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 
@@ -17,7 +18,7 @@ namespace engine::resource {
             Mix_Quit(); // 如果OpenAudio失败，先清理Mix_Init，再抛出异常
             throw std::runtime_error("AudioManager 错误: Mix_OpenAudio 失败: " + std::string(SDL_GetError()));
         }
-        spdlog::trace("AudioManager 构造成功。");
+        ENGINE_LOG_TRACE("AudioManager 构造成功。");
     }
 
     AudioManager::~AudioManager()
@@ -35,7 +36,7 @@ namespace engine::resource {
 
         // 退出SDL_mixer子系统
         Mix_Quit();
-        spdlog::trace("AudioManager 析构成功。");
+        ENGINE_LOG_TRACE("AudioManager 析构成功。");
     }
 
     // --- 音效管理 ---
@@ -47,7 +48,7 @@ namespace engine::resource {
         }
 
         // 加载音效块
-        spdlog::debug("加载音效: {}", file_path);
+        ENGINE_LOG_DEBUG("加载音效: {}", file_path);
         Mix_Chunk* raw_chunk = Mix_LoadWAV(file_path.c_str());
         if (!raw_chunk) {
             spdlog::error("加载音效失败: '{}': {}", file_path, SDL_GetError());
@@ -56,7 +57,7 @@ namespace engine::resource {
 
         // 使用unique_ptr存储在缓存中
         sounds_.emplace(file_path, std::unique_ptr<Mix_Chunk, SDLMixChunkDeleter>(raw_chunk));
-        spdlog::debug("成功加载并缓存音效: {}", file_path);
+        ENGINE_LOG_DEBUG("成功加载并缓存音效: {}", file_path);
         return raw_chunk;
     }
 
@@ -72,7 +73,7 @@ namespace engine::resource {
     void AudioManager::unloadSound(const std::string& file_path) {
         auto it = sounds_.find(file_path);
         if (it != sounds_.end()) {
-            spdlog::debug("卸载音效: {}", file_path);
+            ENGINE_LOG_DEBUG("卸载音效: {}", file_path);
             sounds_.erase(it);      // unique_ptr处理Mix_FreeChunk
         }
         else {
@@ -82,7 +83,7 @@ namespace engine::resource {
 
     void AudioManager::clearSounds() {
         if (!sounds_.empty()) {
-            spdlog::debug("正在清除所有 {} 个缓存的音效。", sounds_.size());
+            ENGINE_LOG_DEBUG("正在清除所有 {} 个缓存的音效。", sounds_.size());
             sounds_.clear(); // unique_ptr处理删除
         }
     }
@@ -96,7 +97,7 @@ namespace engine::resource {
         }
 
         // 加载音乐
-        spdlog::debug("加载音乐: {}", file_path);
+        ENGINE_LOG_DEBUG("加载音乐: {}", file_path);
         Mix_Music* raw_music = Mix_LoadMUS(file_path.c_str());
         if (!raw_music) {
             spdlog::error("加载音乐失败: '{}': {}", file_path, SDL_GetError());
@@ -105,7 +106,7 @@ namespace engine::resource {
 
         // 使用unique_ptr存储在缓存中
         music_.emplace(file_path, std::unique_ptr<Mix_Music, SDLMixMusicDeleter>(raw_music));
-        spdlog::debug("成功加载并缓存音乐: {}", file_path);
+        ENGINE_LOG_DEBUG("成功加载并缓存音乐: {}", file_path);
         return raw_music;
     }
 
@@ -121,7 +122,7 @@ namespace engine::resource {
     void AudioManager::unloadMusic(const std::string& file_path) {
         auto it = music_.find(file_path);
         if (it != music_.end()) {
-            spdlog::debug("卸载音乐: {}", file_path);
+            ENGINE_LOG_DEBUG("卸载音乐: {}", file_path);
             music_.erase(it); // unique_ptr处理Mix_FreeMusic
         }
         else {
@@ -131,7 +132,7 @@ namespace engine::resource {
 
     void AudioManager::clearMusic() {
         if (!music_.empty()) {
-            spdlog::debug("正在清除所有 {} 个缓存的音乐曲目。", music_.size());
+            ENGINE_LOG_DEBUG("正在清除所有 {} 个缓存的音乐曲目。", music_.size());
             music_.clear(); // unique_ptr处理删除
         }
     }
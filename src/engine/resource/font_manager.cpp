@@ -1,4 +1,5 @@
 #include "font_manager.h"
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 #include <stdexcept>
 
@@ -8,16 +9,16 @@ namespace engine::resource {
         if (!TTF_WasInit() && !TTF_Init()) {
             throw std::runtime_error("FontManager 错误: TTF_Init 失败：" + std::string(SDL_GetError()));
         }
-        spdlog::trace("FontManager 构造成功。");
+        ENGINE_LOG_TRACE("FontManager 构造成功。");
     }
 
     FontManager::~FontManager() {
         if (!fonts_.empty()) {
-            spdlog::debug("FontManager 不为空，调用 clearFonts 处理清理逻辑。");
+            ENGINE_LOG_DEBUG("FontManager 不为空，调用 clearFonts 处理清理逻辑。");
             clearFonts();       // 调用 clearFonts 处理清理逻辑
         }
         TTF_Quit();
-        spdlog::trace("FontManager 析构成功。");
+        ENGINE_LOG_TRACE("FontManager 析构成功。");
     }
 
     TTF_Font* FontManager::loadFont(const std::string& file_path, int point_size) {
@@ -37,7 +38,7 @@ namespace engine::resource {
         }
 
         // 缓存中不存在，则加载字体
-        spdlog::debug("正在加载字体：{} ({}pt)", file_path, point_size);
+        ENGINE_LOG_DEBUG("正在加载字体：{} ({}pt)", file_path, point_size);
         TTF_Font* raw_font = TTF_OpenFont(file_path.c_str(), point_size);
         if (!raw_font) {
             spdlog::error("加载字体 '{}' ({}pt) 失败：{}", file_path, point_size, SDL_GetError());
@@ -46,7 +47,7 @@ namespace engine::resource {
 
         // 使用 unique_ptr 存储到缓存中
         fonts_.emplace(key, std::unique_ptr<TTF_Font, SDLFontDeleter>(raw_font));
-        spdlog::debug("成功加载并缓存字体：{} ({}pt)", file_path, point_size);
+        ENGINE_LOG_DEBUG("成功加载并缓存字体：{} ({}pt)", file_path, point_size);
         return raw_font;
     }
 
@@ -65,7 +66,7 @@ namespace engine::resource {
         FontKey key = { file_path, point_size };
         auto it = fonts_.find(key);
         if (it != fonts_.end()) {
-            spdlog::debug("卸载字体：{} ({}pt)", file_path, point_size);
+            ENGINE_LOG_DEBUG("卸载字体：{} ({}pt)", file_path, point_size);
             fonts_.erase(it);       // unique_ptr 会处理 TTF_CloseFont
         }
         else {
@@ -75,7 +76,7 @@ namespace engine::resource {
 
     void FontManager::clearFonts() {
         if (!fonts_.empty()) {
-            spdlog::debug("正在清理所有 {} 个缓存的字体。", fonts_.size());
+            ENGINE_LOG_DEBUG("正在清理所有 {} 个缓存的字体。", fonts_.size());
             fonts_.clear();         // unique_ptr 会处理删除
         }
     }
@@ -0,0 +1,56 @@
+#include "image_decoder.h"
+#include "../core/profiler.h"
+#include <SDL3/SDL_surface.h>
+#include <SDL3_image/SDL_image.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <thread>
+
+namespace engine::resource {
+
+    void SDLSurfaceDeleter::operator()(SDL_Surface* surface) const {
+        if (surface) {
+            SDL_DestroySurface(surface);
+        }
+    }
+
+    std::vector<DecodedImage> decodeImages(const std::vector<std::string>& file_paths, unsigned int max_threads,
+                                           const std::atomic<bool>* cancelled) {
+        std::vector<DecodedImage> results(file_paths.size());
+        if (file_paths.empty()) return results;
+
+        std::atomic<size_t> next_index = 0;
+        auto decode_worker = [&]() {
+            for (size_t i = next_index++; i < file_paths.size(); i = next_index++) {
+                if (cancelled && *cancelled) return;
+                ENGINE_PROFILE_SCOPE("decodeImage");
+                auto& result = results[i];      // 每个下标只由一个线程写入
+                result.file_path = file_paths[i];
+                result.surface.reset(IMG_Load(file_paths[i].c_str()));
+                if (!result.surface) {
+                    spdlog::error("解码图片失败: '{}': {}", file_paths[i], SDL_GetError());
+                }
+            }
+        };
+
+        // 线程数不超过图片数量；调用线程也参与解码
+        unsigned int thread_count = max_threads > 0 ? max_threads : std::max(1u, std::thread::hardware_concurrency());
+        thread_count = static_cast<unsigned int>(std::min<size_t>(thread_count, file_paths.size()));
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count - 1);
+        for (unsigned int i = 1; i < thread_count; ++i) {
+            threads.emplace_back(decode_worker);
+        }
+        decode_worker();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        // 因取消而跳过的图片也填上路径，方便调用者统一处理
+        for (size_t i = 0; i < results.size(); ++i) {
+            if (results[i].file_path.empty()) results[i].file_path = file_paths[i];
+        }
+        return results;
+    }
+
+} // namespace engine::resource
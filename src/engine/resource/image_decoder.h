@@ -0,0 +1,35 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct SDL_Surface;
+
+namespace engine::resource {
+
+    /// @brief SDL_Surface 的删除器函数对象，用于智能指针管理
+    struct SDLSurfaceDeleter {
+        void operator()(SDL_Surface* surface) const;
+    };
+
+    /// @brief 一张已解码的图片（解码失败时 surface 为空）
+    struct DecodedImage {
+        std::string file_path;                                  ///< @brief 图片路径
+        std::unique_ptr<SDL_Surface, SDLSurfaceDeleter> surface;///< @brief 解码结果
+    };
+
+    /**
+     * @brief 并行解码一组图片文件 (IMG_Load)。
+     *
+     * 启动最多 max_threads 个线程（0 表示硬件线程数），各线程依次领取下一张图片解码。
+     * 解码不涉及渲染器，可以在任意线程调用；得到的 SDL_Surface 需在主线程上传为纹理。
+     * @param file_paths 图片路径
+     * @param max_threads 最多使用的线程数，0 表示使用硬件线程数
+     * @param cancelled 可选：取消标志，置为 true 后尚未开始的图片不再解码（结果中 surface 为空）
+     * @return 与 file_paths 顺序一致的解码结果
+     */
+    std::vector<DecodedImage> decodeImages(const std::vector<std::string>& file_paths, unsigned int max_threads = 0,
+                                           const std::atomic<bool>* cancelled = nullptr);
+
+} // namespace engine::resource
@@ -5,11 +5,16 @@
 #include <SDL3_mixer/SDL_mixer.h>
 #include <SDL3_ttf/SDL_ttf.h> 
 #include <glm/glm.hpp>
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::resource {
 
-    ResourceManager::~ResourceManager() = default;
+    ResourceManager::~ResourceManager() {
+        if (texture_manager_ && texture_manager_->getMissCount() > 0) {
+            spdlog::info("运行期间纹理未命中缓存共 {} 次（见之前的警告日志）。", texture_manager_->getMissCount());
+        }
+    }
 
     ResourceManager::ResourceManager(SDL_Renderer* renderer) {
         // --- 初始化各个子系统 --- (如果出现错误会抛出异常，由上层捕获)
@@ -17,7 +22,7 @@ namespace engine::resource {
         audio_manager_ = std::make_unique<AudioManager>();
         font_manager_ = std::make_unique<FontManager>();
 
-        spdlog::trace("ResourceManager 构造成功。");
+        ENGINE_LOG_TRACE("ResourceManager 构造成功。");
         // RAII: 构造成功即代表资源管理器可以正常工作，无需再初始化，无需检查指针是否为空
     }
 
@@ -25,7 +30,7 @@ namespace engine::resource {
         font_manager_->clearFonts();
         audio_manager_->clearSounds();
         texture_manager_->clearTextures();
-        spdlog::trace("ResourceManager 中的资源通过 clear() 清空。");
+        ENGINE_LOG_TRACE("ResourceManager 中的资源通过 clear() 清空。");
     }
 
     // --- 纹理接口实现 ---
@@ -50,6 +55,42 @@ namespace engine::resource {
         texture_manager_->clearTextures();
     }
 
+    TextureHandle ResourceManager::getTextureHandle(const std::string& file_path) {
+        return texture_manager_->getTextureHandle(file_path);
+    }
+
+    SDL_Texture* ResourceManager::getTexture(TextureHandle handle) {
+        return texture_manager_->getTexture(handle);
+    }
+
+    glm::vec2 ResourceManager::getTextureSize(TextureHandle handle) {
+        return texture_manager_->getTextureSize(handle);
+    }
+
+    const std::string& ResourceManager::getTexturePath(TextureHandle handle) const {
+        return texture_manager_->getTexturePath(handle);
+    }
+
+    SDL_Texture* ResourceManager::loadTextureFromSurface(const std::string& file_path, SDL_Surface* surface) {
+        return texture_manager_->loadTextureFromSurface(file_path, surface);
+    }
+
+    size_t ResourceManager::preloadTextures(const std::vector<std::string>& file_paths) {
+        return texture_manager_->preloadTextures(file_paths);
+    }
+
+    size_t ResourceManager::getTextureMissCount() const {
+        return texture_manager_->getMissCount();
+    }
+
+    void ResourceManager::resetTextureMissCount() {
+        texture_manager_->resetMissCount();
+    }
+
+    void ResourceManager::setFrameCounters(engine::core::FrameCounters* counters) {
+        texture_manager_->setFrameCounters(counters);
+    }
+
     // --- 音频接口实现 ---
     Mix_Chunk* ResourceManager::loadSound(const std::string& file_path) {
         return audio_manager_->loadSound(file_path);
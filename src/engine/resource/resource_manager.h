@@ -1,15 +1,22 @@
 #pragma once
 #include <memory> // 用于 std::unique_ptr
 #include <string> // 用于 std::string
+#include <vector>
 #include <glm/glm.hpp>
+#include "texture_handle.h"
 
 // 前向声明 SDL 类型
 struct SDL_Renderer;
 struct SDL_Texture;
+struct SDL_Surface;
 struct Mix_Chunk;
 struct Mix_Music;
 struct TTF_Font;
 
+namespace engine::core {
+    class FrameCounters;
+}
+
 namespace engine::resource {
 
     // 前向声明内部管理器
@@ -52,6 +59,19 @@ namespace engine::resource {
         void unloadTexture(const std::string& file_path);          ///< @brief 卸载指定的纹理资源
         glm::vec2 getTextureSize(const std::string& file_path);    ///< @brief 获取指定纹理的尺寸
         void clearTextures();                                      ///< @brief 清空所有纹理资源
+        // 句柄接口：先用路径换取句柄（一次哈希查找），之后的访问直接索引，适合每帧调用
+        TextureHandle getTextureHandle(const std::string& file_path); ///< @brief 获取纹理句柄，未加载则加载。失败返回无效句柄
+        SDL_Texture* getTexture(TextureHandle handle);             ///< @brief 通过句柄获取纹理
+        glm::vec2 getTextureSize(TextureHandle handle);            ///< @brief 通过句柄获取纹理尺寸（加载时缓存）
+        const std::string& getTexturePath(TextureHandle handle) const; ///< @brief 获取句柄对应的文件路径（用于日志），无效句柄返回空字符串
+        /// @brief 用已解码的图片（例如后台线程解码的）创建并缓存纹理，已加载则直接返回。需在主线程调用
+        SDL_Texture* loadTextureFromSurface(const std::string& file_path, SDL_Surface* surface);
+        /// @brief 预加载纹理清单：并行解码未加载的图片后一次性上传，返回新加载的数量。需在主线程调用
+        size_t preloadTextures(const std::vector<std::string>& file_paths);
+        size_t getTextureMissCount() const;                        ///< @brief 获取纹理未命中缓存（运行中同步加载）的次数
+        void resetTextureMissCount();                              ///< @brief 重置纹理未命中计数
+        /// @brief 设置每帧计数器注册表（纹理缓存命中/未命中），传入 nullptr 则不再计数
+        void setFrameCounters(engine::core::FrameCounters* counters);
 
         // -- Sound Effects (Chunks) --
         Mix_Chunk* loadSound(const std::string& file_path);         ///< @brief 载入音效资源
@@ -0,0 +1,22 @@
+#pragma once
+#include <cstdint>
+
+namespace engine::resource {
+
+    /**
+     * @brief 纹理句柄：TextureManager 内部纹理表的下标。
+     *
+     * 由 ResourceManager::getTextureHandle 根据文件路径换取（每个路径只分配一次，之后永远有效），
+     * 绘制时通过句柄直接索引纹理及其缓存的尺寸，不再需要对路径字符串做哈希查找。
+     * @note 卸载纹理不会使句柄失效，再次通过句柄访问时会重新加载。
+     */
+    struct TextureHandle {
+        static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu; ///< @brief 无效句柄的下标
+
+        std::uint32_t index = INVALID_INDEX;                        ///< @brief 纹理表下标
+
+        bool isValid() const { return index != INVALID_INDEX; }     ///< @brief 是否为有效句柄
+        bool operator==(const TextureHandle&) const = default;
+    };
+
+} // namespace engine::resource
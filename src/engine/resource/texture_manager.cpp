@@ -1,6 +1,9 @@
 #include "texture_manager.h"
+#include "image_decoder.h"
 #include <SDL3_image/SDL_image.h> // 用于 IMG_LoadTexture, IMG_Init, IMG_Quit
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
+#include <chrono>
 #include <stdexcept>
 
 namespace engine::resource {
@@ -10,70 +13,48 @@ namespace engine::resource {
             throw std::runtime_error("TextureManager 构造失败: 渲染器指针为空。");
         }
         // SDL3中不再需要手动调用IMG_Init/IMG_Quit
-        spdlog::trace("TextureManager 构造成功。");
+        ENGINE_LOG_TRACE("TextureManager 构造成功。");
     }
 
     SDL_Texture* TextureManager::loadTexture(const std::string& file_path) {
-        // 检查是否已加载
-        auto it = textures_.find(file_path);
-        if (it != textures_.end()) {
-            return it->second.get();
+        // 已加载则直接返回，否则加载纹理
+        auto& entry = entries_[internPath(file_path)];
+        if (entry.texture) {
+            return entry.texture.get();
         }
-
-        // 如果没加载则尝试加载纹理
-        SDL_Texture* raw_texture = IMG_LoadTexture(renderer_, file_path.c_str());
-
-        // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
-        if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) {
-            spdlog::warn("无法设置纹理缩放模式为最邻近插值");
-        }
-
-        if (!raw_texture) {
-            spdlog::error("加载纹理失败: '{}': {}", file_path, SDL_GetError());
-            return nullptr;
-        }
-
-        // 使用带有自定义删除器的 unique_ptr 存储加载的纹理
-        textures_.emplace(file_path, std::unique_ptr<SDL_Texture, SDLTextureDeleter>(raw_texture));
-        spdlog::debug("成功加载并缓存纹理: {}", file_path);
-
-        return raw_texture;
+        return loadEntry(entry);
     }
 
     SDL_Texture* TextureManager::getTexture(const std::string& file_path) {
         // 查找现有纹理
-        auto it = textures_.find(file_path);
-        if (it != textures_.end()) {
-            return it->second.get();
+        auto it = handles_.find(file_path);
+        if (it != handles_.end() && entries_[it->second].texture) {
+            countHit();
+            return entries_[it->second].texture.get();
         }
 
         // 如果未找到，尝试加载它
-        spdlog::warn("纹理 '{}' 未找到缓存，尝试加载。", file_path);
-        return loadTexture(file_path);
+        return loadMissedEntry(entries_[internPath(file_path)]);
     }
 
     glm::vec2 TextureManager::getTextureSize(const std::string& file_path) {
-        // 获取纹理
-        SDL_Texture* texture = getTexture(file_path);
-        if (!texture) {
+        // 获取纹理（同时确保尺寸已缓存）
+        if (!getTexture(file_path)) {
             spdlog::error("无法获取纹理: {}", file_path);
             return glm::vec2(0);
         }
-
-        // 获取纹理尺寸
-        glm::vec2 size;
-        if (!SDL_GetTextureSize(texture, &size.x, &size.y)) {
-            spdlog::error("无法查询纹理尺寸: {}", file_path);
-            return glm::vec2(0);
-        }
-        return size;
+        return entries_[handles_.at(file_path)].size;
     }
 
     void TextureManager::unloadTexture(const std::string& file_path) {
-        auto it = textures_.find(file_path);
-        if (it != textures_.end()) {
-            spdlog::debug("卸载纹理: {}", file_path);
-            textures_.erase(it); // unique_ptr 通过自定义删除器处理删除
+        auto it = handles_.find(file_path);
+        if (it != handles_.end() && entries_[it->second].texture) {
+            ENGINE_LOG_DEBUG("卸载纹理: {}", file_path);
+            // 只释放纹理，保留表项，使已分配的句柄仍然有效 (unique_ptr 通过自定义删除器处理删除)
+            auto& entry = entries_[it->second];
+            entry.texture.reset();
+            entry.size = glm::vec2(0);
+            --loaded_count_;
         }
         else {
             spdlog::warn("尝试卸载不存在的纹理: {}", file_path);
@@ -81,10 +62,146 @@ namespace engine::resource {
     }
 
     void TextureManager::clearTextures() {
-        if (!textures_.empty()) {
-            spdlog::debug("正在清除所有 {} 个缓存的纹理。", textures_.size());
-            textures_.clear(); // unique_ptr 处理所有元素的删除
+        if (loaded_count_ > 0) {
+            ENGINE_LOG_DEBUG("正在清除所有 {} 个缓存的纹理。", loaded_count_);
+            for (auto& entry : entries_) {
+                entry.texture.reset();      // unique_ptr 处理所有元素的删除
+                entry.size = glm::vec2(0);
+            }
+            loaded_count_ = 0;
+        }
+    }
+
+    TextureHandle TextureManager::getTextureHandle(const std::string& file_path) {
+        std::uint32_t index = internPath(file_path);
+        auto& entry = entries_[index];
+        if (entry.texture) {
+            countHit();
+        }
+        else if (!loadMissedEntry(entry)) {
+            return TextureHandle{};
+        }
+        return TextureHandle{ index };
+    }
+
+    SDL_Texture* TextureManager::getTexture(TextureHandle handle) {
+        if (handle.index >= entries_.size()) {
+            spdlog::error("无效的纹理句柄: {}", handle.index);
+            return nullptr;
+        }
+        auto& entry = entries_[handle.index];
+        if (entry.texture) {
+            countHit();
+            return entry.texture.get();
+        }
+        // 纹理已被卸载，尝试重新加载
+        return loadMissedEntry(entry);
+    }
+
+    glm::vec2 TextureManager::getTextureSize(TextureHandle handle) {
+        if (!getTexture(handle)) {
+            return glm::vec2(0);
+        }
+        return entries_[handle.index].size;
+    }
+
+    const std::string& TextureManager::getTexturePath(TextureHandle handle) const {
+        static const std::string empty;
+        return handle.index < entries_.size() ? entries_[handle.index].file_path : empty;
+    }
+
+    SDL_Texture* TextureManager::loadTextureFromSurface(const std::string& file_path, SDL_Surface* surface) {
+        auto& entry = entries_[internPath(file_path)];
+        if (entry.texture) {
+            return entry.texture.get();
+        }
+        if (!surface) {
+            spdlog::error("纹理 '{}' 的图片为空。", file_path);
+            return nullptr;
+        }
+        SDL_Texture* raw_texture = SDL_CreateTextureFromSurface(renderer_, surface);
+        if (!raw_texture) {
+            spdlog::error("从图片创建纹理失败: '{}': {}", file_path, SDL_GetError());
+            return nullptr;
+        }
+        return storeEntry(entry, raw_texture);
+    }
+
+    size_t TextureManager::preloadTextures(const std::vector<std::string>& file_paths) {
+        // 1. 筛选出尚未加载的路径（去重）
+        std::vector<std::string> missing;
+        std::vector<bool> queued(entries_.size(), false);
+        for (const auto& file_path : file_paths) {
+            auto index = internPath(file_path);
+            if (index >= queued.size()) queued.resize(index + 1, false);
+            if (entries_[index].texture || queued[index]) continue;
+            queued[index] = true;
+            missing.push_back(file_path);
+        }
+        if (missing.empty()) return 0;
+
+        // 2. 并行解码，3. 在当前线程一次性上传
+        auto start = std::chrono::steady_clock::now();
+        auto images = decodeImages(missing);
+        size_t loaded = 0;
+        for (auto& image : images) {
+            if (image.surface && loadTextureFromSurface(image.file_path, image.surface.get())) {
+                ++loaded;
+            }
+        }
+        auto elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        spdlog::info("预加载纹理 {}/{} 个，用时 {:.1f} ms", loaded, missing.size(), elapsed);
+        return loaded;
+    }
+
+    SDL_Texture* TextureManager::loadMissedEntry(TextureEntry& entry) {
+        ++miss_count_;
+        if (frame_counters_) frame_counters_->add(miss_counter_);
+        spdlog::warn("纹理 '{}' 未找到缓存，同步加载（第 {} 次未命中，应加入预加载清单）。", entry.file_path, miss_count_);
+        return loadEntry(entry);
+    }
+
+    void TextureManager::setFrameCounters(engine::core::FrameCounters* counters) {
+        frame_counters_ = counters;
+        if (!frame_counters_) return;
+        hit_counter_ = frame_counters_->registerCounter("resource.texture_hits");
+        miss_counter_ = frame_counters_->registerCounter("resource.texture_misses");
+    }
+
+    std::uint32_t TextureManager::internPath(const std::string& file_path) {
+        auto [it, inserted] = handles_.try_emplace(file_path, static_cast<std::uint32_t>(entries_.size()));
+        if (inserted) {
+            entries_.push_back(TextureEntry{ nullptr, glm::vec2(0), file_path });
         }
+        return it->second;
+    }
+
+    SDL_Texture* TextureManager::loadEntry(TextureEntry& entry) {
+        SDL_Texture* raw_texture = IMG_LoadTexture(renderer_, entry.file_path.c_str());
+        if (!raw_texture) {
+            spdlog::error("加载纹理失败: '{}': {}", entry.file_path, SDL_GetError());
+            return nullptr;
+        }
+        return storeEntry(entry, raw_texture);
+    }
+
+    SDL_Texture* TextureManager::storeEntry(TextureEntry& entry, SDL_Texture* raw_texture) {
+        // 载入纹理时，设置纹理缩放模式为最邻近插值(必不可少，否则TileLayer渲染中会出现边缘空隙/模糊)
+        if (!SDL_SetTextureScaleMode(raw_texture, SDL_SCALEMODE_NEAREST)) {
+            spdlog::warn("无法设置纹理缩放模式为最邻近插值");
+        }
+
+        // 缓存纹理尺寸，之后的尺寸查询不再调用 SDL
+        if (!SDL_GetTextureSize(raw_texture, &entry.size.x, &entry.size.y)) {
+            spdlog::error("无法查询纹理尺寸: {}", entry.file_path);
+            entry.size = glm::vec2(0);
+        }
+
+        // 使用带有自定义删除器的 unique_ptr 存储加载的纹理
+        entry.texture.reset(raw_texture);
+        ++loaded_count_;
+        ENGINE_LOG_DEBUG("成功加载并缓存纹理: {}", entry.file_path);
+        return raw_texture;
     }
 
-} // namespace engine::resource
\ No newline at end of file
+} // namespace engine::resource
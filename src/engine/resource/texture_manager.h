@@ -3,6 +3,9 @@
 #include <stdexcept>    // 用于 std::runtime_error
 #include <string>       // 用于 std::string
 #include <unordered_map> // 用于 std::unordered_map
+#include <vector>       // 用于 std::vector
+#include "texture_handle.h"
+#include "../core/frame_counters.h"
 #include <SDL3/SDL_render.h> // 用于 SDL_Texture 和 SDL_Renderer
 #include <glm/glm.hpp>
 
@@ -12,6 +15,8 @@ namespace engine::resource {
      * @brief 管理 SDL_Texture 资源的加载、存储和检索。
      *
      * 在构造时初始化。使用文件路径作为键，确保纹理只加载一次并正确释放。
+     * 每个路径第一次出现时被分配一个 TextureHandle（纹理表下标，之后不再改变），
+     * 纹理尺寸在加载时缓存，通过句柄访问无需哈希查找。
      * 依赖于一个有效的 SDL_Renderer，构造失败会抛出异常。
      */
     class TextureManager final {
@@ -27,8 +32,21 @@ namespace engine::resource {
             }
         };
 
-        // 存储文件路径和指向管理纹理的 unique_ptr 的映射。
-        std::unordered_map<std::string, std::unique_ptr<SDL_Texture, SDLTextureDeleter>> textures_;
+        /// @brief 纹理表中的一项（下标即 TextureHandle）
+        struct TextureEntry {
+            std::unique_ptr<SDL_Texture, SDLTextureDeleter> texture;    ///< @brief 纹理（未加载或已卸载时为空）
+            glm::vec2 size = { 0.0f, 0.0f };                            ///< @brief 缓存的纹理尺寸
+            std::string file_path;                                      ///< @brief 文件路径（用于重新加载和日志）
+        };
+
+        std::vector<TextureEntry> entries_;                             ///< @brief 纹理表，只增不减，保证句柄始终有效
+        std::unordered_map<std::string, std::uint32_t> handles_;       ///< @brief 文件路径到纹理表下标的映射
+        size_t loaded_count_ = 0;                                       ///< @brief 当前已加载的纹理数量
+        size_t miss_count_ = 0;                                         ///< @brief 获取纹理时未命中缓存（只能同步读盘解码）的次数
+
+        engine::core::FrameCounters* frame_counters_ = nullptr;         ///< @brief 每帧计数器注册表（非拥有，可能为空）
+        engine::core::CounterId hit_counter_ = 0;                       ///< @brief 缓存命中计数器编号
+        engine::core::CounterId miss_counter_ = 0;                      ///< @brief 缓存未命中计数器编号
 
         SDL_Renderer* renderer_ = nullptr; // 指向主渲染器的非拥有指针
 
@@ -52,7 +70,39 @@ namespace engine::resource {
         SDL_Texture* getTexture(const std::string& file_path);       ///< @brief 尝试获取已加载纹理的指针，如果未加载则尝试加载
         glm::vec2 getTextureSize(const std::string& file_path);      ///< @brief 获取指定纹理的尺寸
         void unloadTexture(const std::string& file_path);            ///< @brief 卸载指定的纹理资源
-        void clearTextures();                                        ///< @brief 清空所有纹理资源
+        void clearTextures();                                        ///< @brief 清空所有纹理资源（已分配的句柄仍然有效）
+
+        // --- 句柄接口（快速路径） ---
+        TextureHandle getTextureHandle(const std::string& file_path); ///< @brief 获取路径对应的句柄，尚未加载则加载。加载失败返回无效句柄
+        SDL_Texture* getTexture(TextureHandle handle);               ///< @brief 通过句柄获取纹理，已卸载则重新加载
+        glm::vec2 getTextureSize(TextureHandle handle);              ///< @brief 通过句柄获取缓存的纹理尺寸
+        const std::string& getTexturePath(TextureHandle handle) const; ///< @brief 获取句柄对应的文件路径（用于日志），无效句柄返回空字符串
+
+        /**
+         * @brief 用已解码的图片创建纹理，并以 file_path 为键缓存（用于后台线程解码图片、主线程上传）。
+         * @param file_path 纹理路径（与 getTexture 等使用的键相同）
+         * @param surface 已解码的图片（调用者保留所有权）
+         * @return 纹理指针。如果该路径已加载，直接返回已有纹理；创建失败返回 nullptr
+         */
+        SDL_Texture* loadTextureFromSurface(const std::string& file_path, SDL_Surface* surface);
+
+        /**
+         * @brief 预加载清单中的纹理：未加载的图片在线程池中并行解码，之后在当前线程一次性上传。
+         * @param file_paths 纹理路径清单（可以重复，已加载的会被跳过）
+         * @return 本次新加载的纹理数量
+         */
+        size_t preloadTextures(const std::vector<std::string>& file_paths);
+        size_t getMissCount() const { return miss_count_; }          ///< @brief 获取未命中缓存的次数
+        void resetMissCount() { miss_count_ = 0; }                   ///< @brief 重置未命中计数
+        void setFrameCounters(engine::core::FrameCounters* counters); ///< @brief 设置每帧计数器注册表并注册命中/未命中计数器
+        void countHit() {                                            ///< @brief 统计一次缓存命中（未设置注册表时忽略）
+            if (frame_counters_) frame_counters_->add(hit_counter_);
+        }
+
+        std::uint32_t internPath(const std::string& file_path);      ///< @brief 为路径分配（或查找）纹理表下标
+        SDL_Texture* loadEntry(TextureEntry& entry);                  ///< @brief 加载纹理表项对应的纹理并缓存尺寸
+        SDL_Texture* storeEntry(TextureEntry& entry, SDL_Texture* raw_texture);  ///< @brief 设置缩放模式、缓存尺寸并保存到表项中
+        SDL_Texture* loadMissedEntry(TextureEntry& entry);            ///< @brief 未命中缓存时同步加载，并计数、报告
     };
 
 } // namespace engine::resource
\ No newline at end of file
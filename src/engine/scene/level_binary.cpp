@@ -0,0 +1,354 @@
+#include "level_binary.h"
+#include "level_data.h"
+#include "../component/tilelayer_component.h"
+#include "../utils/mapped_file.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+#include <spdlog/spdlog.h>
+
+namespace engine::scene {
+
+    namespace {
+        constexpr std::uint32_t LEVEL_BINARY_MAGIC = 0x3142564C;    // "LVB1"
+        constexpr std::uint32_t LEVEL_BINARY_VERSION = 1;           // 格式改变时递增
+
+        /// @brief 源文件的指纹（大小 + 修改时间）
+        struct SourceStamp {
+            std::uint64_t size = 0;
+            std::int64_t write_time = 0;
+        };
+
+        std::optional<SourceStamp> getSourceStamp(const std::string& file_path) {
+            std::error_code ec;
+            auto size = std::filesystem::file_size(file_path, ec);
+            if (ec) return std::nullopt;
+            auto write_time = std::filesystem::last_write_time(file_path, ec);
+            if (ec) return std::nullopt;
+            return SourceStamp{ size, static_cast<std::int64_t>(write_time.time_since_epoch().count()) };
+        }
+
+        /// @brief 顺序写入基本类型、字符串和数组
+        class BinaryWriter {
+        public:
+            std::vector<char> buffer;
+
+            template <typename T>
+            void write(const T& value) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                auto bytes = reinterpret_cast<const char*>(&value);
+                buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+            }
+            void writeString(const std::string& value) {
+                write(static_cast<std::uint32_t>(value.size()));
+                buffer.insert(buffer.end(), value.begin(), value.end());
+            }
+            template <typename T>
+            void writeArray(const std::vector<T>& values) {
+                static_assert(std::is_trivially_copyable_v<T>);
+                write(static_cast<std::uint32_t>(values.size()));
+                auto bytes = reinterpret_cast<const char*>(values.data());
+                buffer.insert(buffer.end(), bytes, bytes + values.size() * sizeof(T));
+            }
+        };
+
+        /// @brief 顺序读取，越界时置 ok = false 并返回默认值（之后的读取全部失败）
+        class BinaryReader {
+        private:
+            const std::byte* cursor_;
+            const std::byte* end_;
+
+        public:
+            bool ok = true;
+
+            BinaryReader(const std::byte* data, std::size_t size) : cursor_(data), end_(data + size) {}
+
+            bool canRead(std::size_t bytes) {
+                if (ok && static_cast<std::size_t>(end_ - cursor_) >= bytes) return true;
+                ok = false;
+                return false;
+            }
+            template <typename T>
+            T read() {
+                static_assert(std::is_trivially_copyable_v<T>);
+                T value{};
+                if (canRead(sizeof(T))) {
+                    std::memcpy(&value, cursor_, sizeof(T));
+                    cursor_ += sizeof(T);
+                }
+                return value;
+            }
+            std::string readString() {
+                auto size = read<std::uint32_t>();
+                if (!canRead(size)) return {};
+                std::string value(reinterpret_cast<const char*>(cursor_), size);
+                cursor_ += size;
+                return value;
+            }
+            template <typename T>
+            std::vector<T> readArray() {
+                static_assert(std::is_trivially_copyable_v<T>);
+                auto count = read<std::uint32_t>();
+                if (!canRead(static_cast<std::size_t>(count) * sizeof(T))) return {};
+                std::vector<T> values(count);
+                std::memcpy(values.data(), cursor_, count * sizeof(T));    // 大块数据（瓦片网格）整体复制
+                cursor_ += count * sizeof(T);
+                return values;
+            }
+            bool atEnd() const { return cursor_ == end_; }
+        };
+
+        void writeRect(BinaryWriter& writer, const SDL_FRect& rect) {
+            writer.write(rect.x); writer.write(rect.y); writer.write(rect.w); writer.write(rect.h);
+        }
+        SDL_FRect readRect(BinaryReader& reader) {
+            SDL_FRect rect;
+            rect.x = reader.read<float>(); rect.y = reader.read<float>(); rect.w = reader.read<float>(); rect.h = reader.read<float>();
+            return rect;
+        }
+        void writeVec2(BinaryWriter& writer, const glm::vec2& value) {
+            writer.write(value.x); writer.write(value.y);
+        }
+        glm::vec2 readVec2(BinaryReader& reader) {
+            float x = reader.read<float>();
+            float y = reader.read<float>();
+            return { x, y };
+        }
+    } // namespace
+
+    std::string getCompiledLevelPath(const std::string& level_path) {
+        return std::filesystem::path(level_path).replace_extension(".lvlbin").string();
+    }
+
+    bool saveCompiledLevel(const std::string& binary_path, const LevelData& data) {
+        BinaryWriter writer;
+        // --- 文件头：标识、版本、源文件指纹 ---
+        writer.write(LEVEL_BINARY_MAGIC);
+        writer.write(LEVEL_BINARY_VERSION);
+        writer.write(static_cast<std::uint32_t>(data.source_files.size()));
+        for (const auto& source : data.source_files) {
+            auto stamp = getSourceStamp(source);
+            if (!stamp) {
+                spdlog::warn("无法获取源文件 '{}' 的信息，不写入二进制关卡。", source);
+                return false;
+            }
+            writer.writeString(source);
+            writer.write(stamp->size);
+            writer.write(stamp->write_time);
+        }
+
+        // --- 地图信息 ---
+        writer.write(data.map_size.x); writer.write(data.map_size.y);
+        writer.write(data.tile_size.x); writer.write(data.tile_size.y);
+
+        // --- 瓦片定义表（精灵源矩形、类型、碰撞盒、属性、动画） ---
+        writer.write(static_cast<std::uint32_t>(data.tile_defs.size()));
+        for (const auto& def : data.tile_defs) {
+            writer.writeString(def.texture_id);
+            writer.write(static_cast<std::uint8_t>(def.source_rect.has_value()));
+            writeRect(writer, def.source_rect.value_or(SDL_FRect{ 0, 0, 0, 0 }));
+            writer.write(static_cast<std::uint8_t>(def.type));
+            writer.write(static_cast<std::uint8_t>(def.collider.has_value()));
+            auto collider = def.collider.value_or(engine::utils::Rect{ glm::vec2(0.0f), glm::vec2(0.0f) });
+            writeVec2(writer, collider.position);
+            writeVec2(writer, collider.size);
+            writer.write(static_cast<std::uint8_t>(def.tag.has_value()));
+            writer.writeString(def.tag.value_or(""));
+            writer.write(static_cast<std::uint8_t>(def.gravity ? (*def.gravity ? 2 : 1) : 0));
+            writer.write(static_cast<std::uint8_t>(def.health.has_value()));
+            writer.write(static_cast<std::int32_t>(def.health.value_or(0)));
+            writer.write(static_cast<std::uint8_t>(def.animation_invalid));
+            writer.write(static_cast<std::uint32_t>(def.animations.size()));
+            for (const auto& anim : def.animations) {
+                writer.writeString(anim.name);
+                writer.write(anim.frame_duration);
+                writer.write(static_cast<std::int32_t>(anim.row));
+                writer.writeArray(anim.frames);
+            }
+        }
+
+        // --- 图层 ---
+        writer.write(static_cast<std::uint32_t>(data.image_layers.size()));
+        for (const auto& layer : data.image_layers) {
+            writer.writeString(layer.name);
+            writer.writeString(layer.texture_id);
+            writeVec2(writer, layer.offset);
+            writeVec2(writer, layer.scroll_factor);
+            writer.write(static_cast<std::uint8_t>(layer.repeat.x));
+            writer.write(static_cast<std::uint8_t>(layer.repeat.y));
+        }
+        writer.write(static_cast<std::uint32_t>(data.tile_layers.size()));
+        for (const auto& layer : data.tile_layers) {
+            writer.writeString(layer.name);
+            writer.write(static_cast<std::uint8_t>(layer.baked));
+            writer.writeArray(layer.tiles);
+        }
+        writer.write(static_cast<std::uint32_t>(data.object_layers.size()));
+        for (const auto& layer : data.object_layers) {
+            writer.writeString(layer.name);
+            writer.write(static_cast<std::uint32_t>(layer.objects.size()));
+            for (const auto& object : layer.objects) {
+                writer.writeString(object.name);
+                writer.write(object.tile);
+                writeVec2(writer, object.position);
+                writeVec2(writer, object.size);
+                writer.write(object.rotation);
+            }
+        }
+        writer.write(static_cast<std::uint32_t>(data.layer_order.size()));
+        for (const auto& ref : data.layer_order) {
+            writer.write(static_cast<std::uint8_t>(ref.kind));
+            writer.write(ref.index);
+        }
+        writer.write(LEVEL_BINARY_MAGIC);   // 结尾标识，用于检查文件是否完整
+
+        // 先写入临时文件再改名，避免中断时留下不完整的文件
+        auto temp_path = binary_path + ".tmp";
+        {
+            std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+            if (!file.is_open()) {
+                spdlog::warn("无法写入二进制关卡文件: {}", binary_path);
+                return false;
+            }
+            file.write(writer.buffer.data(), static_cast<std::streamsize>(writer.buffer.size()));
+            if (!file) {
+                spdlog::warn("写入二进制关卡文件失败: {}", binary_path);
+                return false;
+            }
+        }
+        std::error_code ec;
+        std::filesystem::rename(temp_path, binary_path, ec);
+        if (ec) {
+            spdlog::warn("重命名二进制关卡文件失败: {} ({})", binary_path, ec.message());
+            std::filesystem::remove(temp_path, ec);
+            return false;
+        }
+        spdlog::info("已写入二进制关卡文件: {} ({} 字节)", binary_path, writer.buffer.size());
+        return true;
+    }
+
+    bool loadCompiledLevel(const std::string& binary_path, LevelData& data) {
+        engine::utils::MappedFile file;
+        if (!file.open(binary_path)) {
+            return false;   // 不存在，使用 JSON 路径
+        }
+        BinaryReader reader(file.data(), file.size());
+
+        // --- 文件头 ---
+        if (reader.read<std::uint32_t>() != LEVEL_BINARY_MAGIC || reader.read<std::uint32_t>() != LEVEL_BINARY_VERSION) {
+            spdlog::info("二进制关卡文件 '{}' 格式或版本不匹配，重新编译。", binary_path);
+            return false;
+        }
+        LevelData result;
+        auto source_count = reader.read<std::uint32_t>();
+        for (std::uint32_t i = 0; i < source_count && reader.ok; ++i) {
+            auto source = reader.readString();
+            SourceStamp recorded;
+            recorded.size = reader.read<std::uint64_t>();
+            recorded.write_time = reader.read<std::int64_t>();
+            auto current = getSourceStamp(source);
+            if (!reader.ok) break;
+            if (!current || current->size != recorded.size || current->write_time != recorded.write_time) {
+                spdlog::info("二进制关卡文件 '{}' 已过期（源文件 '{}' 已改变），重新编译。", binary_path, source);
+                return false;
+            }
+            result.source_files.push_back(std::move(source));
+        }
+
+        // --- 地图信息 ---
+        result.map_size.x = reader.read<std::int32_t>(); result.map_size.y = reader.read<std::int32_t>();
+        result.tile_size.x = reader.read<std::int32_t>(); result.tile_size.y = reader.read<std::int32_t>();
+
+        // --- 瓦片定义表 ---
+        auto def_count = reader.read<std::uint32_t>();
+        result.tile_defs.reserve(reader.ok ? def_count : 0);
+        for (std::uint32_t i = 0; i < def_count && reader.ok; ++i) {
+            LevelTileDef def;
+            def.texture_id = reader.readString();
+            bool has_rect = reader.read<std::uint8_t>() != 0;
+            auto rect = readRect(reader);
+            if (has_rect) def.source_rect = rect;
+            def.type = static_cast<engine::component::TileType>(reader.read<std::uint8_t>());
+            bool has_collider = reader.read<std::uint8_t>() != 0;
+            engine::utils::Rect collider;
+            collider.position = readVec2(reader);
+            collider.size = readVec2(reader);
+            if (has_collider) def.collider = collider;
+            bool has_tag = reader.read<std::uint8_t>() != 0;
+            auto tag = reader.readString();
+            if (has_tag) def.tag = std::move(tag);
+            auto gravity = reader.read<std::uint8_t>();
+            if (gravity != 0) def.gravity = (gravity == 2);
+            bool has_health = reader.read<std::uint8_t>() != 0;
+            auto health = reader.read<std::int32_t>();
+            if (has_health) def.health = health;
+            def.animation_invalid = reader.read<std::uint8_t>() != 0;
+            auto anim_count = reader.read<std::uint32_t>();
+            for (std::uint32_t a = 0; a < anim_count && reader.ok; ++a) {
+                LevelAnimation anim;
+                anim.name = reader.readString();
+                anim.frame_duration = reader.read<float>();
+                anim.row = reader.read<std::int32_t>();
+                anim.frames = reader.readArray<int>();
+                def.animations.push_back(std::move(anim));
+            }
+            result.tile_defs.push_back(std::move(def));
+        }
+
+        // --- 图层 ---
+        auto image_count = reader.read<std::uint32_t>();
+        for (std::uint32_t i = 0; i < image_count && reader.ok; ++i) {
+            LevelImageLayer layer;
+            layer.name = reader.readString();
+            layer.texture_id = reader.readString();
+            layer.offset = readVec2(reader);
+            layer.scroll_factor = readVec2(reader);
+            layer.repeat.x = reader.read<std::uint8_t>() != 0;
+            layer.repeat.y = reader.read<std::uint8_t>() != 0;
+            result.image_layers.push_back(std::move(layer));
+        }
+        auto tile_count = reader.read<std::uint32_t>();
+        for (std::uint32_t i = 0; i < tile_count && reader.ok; ++i) {
+            LevelTileLayer layer;
+            layer.name = reader.readString();
+            layer.baked = reader.read<std::uint8_t>() != 0;
+            layer.tiles = reader.readArray<std::uint32_t>();
+            result.tile_layers.push_back(std::move(layer));
+        }
+        auto object_layer_count = reader.read<std::uint32_t>();
+        for (std::uint32_t i = 0; i < object_layer_count && reader.ok; ++i) {
+            LevelObjectLayer layer;
+            layer.name = reader.readString();
+            auto object_count = reader.read<std::uint32_t>();
+            for (std::uint32_t j = 0; j < object_count && reader.ok; ++j) {
+                LevelObject object;
+                object.name = reader.readString();
+                object.tile = reader.read<std::uint32_t>();
+                object.position = readVec2(reader);
+                object.size = readVec2(reader);
+                object.rotation = reader.read<float>();
+                layer.objects.push_back(std::move(object));
+            }
+            result.object_layers.push_back(std::move(layer));
+        }
+        auto order_count = reader.read<std::uint32_t>();
+        for (std::uint32_t i = 0; i < order_count && reader.ok; ++i) {
+            LevelLayerRef ref;
+            ref.kind = static_cast<LevelLayerKind>(reader.read<std::uint8_t>());
+            ref.index = reader.read<std::uint32_t>();
+            result.layer_order.push_back(ref);
+        }
+
+        if (reader.read<std::uint32_t>() != LEVEL_BINARY_MAGIC || !reader.ok || !reader.atEnd()) {
+            spdlog::warn("二进制关卡文件 '{}' 已损坏，重新编译。", binary_path);
+            return false;
+        }
+        data = std::move(result);
+        spdlog::info("从二进制关卡文件加载: {}", binary_path);
+        return true;
+    }
+
+} // namespace engine::scene
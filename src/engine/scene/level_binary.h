@@ -0,0 +1,19 @@
+#pragma once
+#include <string>
+
+namespace engine::scene {
+    struct LevelData;
+
+    /**
+     * @brief 编译后的二进制关卡文件（.lvlbin）。
+     *
+     * 首次加载 Tiled 关卡时，LevelLoader 把解析结果 (LevelData) 写入与地图同名的 .lvlbin 文件；
+     * 之后加载时通过内存映射读取，直接重建 LevelData，不再解析 JSON。
+     * 文件头记录了所有源文件（地图及图块集）的大小和修改时间，任何一个改变都视为过期。
+     * @note 数据以本机字节序写入（目标平台均为小端），文件格式版本改变时旧文件自动失效。
+     */
+    std::string getCompiledLevelPath(const std::string& level_path);                    ///< @brief 获取关卡对应的二进制文件路径
+    bool saveCompiledLevel(const std::string& binary_path, const LevelData& data);      ///< @brief 写入二进制关卡文件
+    bool loadCompiledLevel(const std::string& binary_path, LevelData& data);            ///< @brief 读取二进制关卡文件，不存在、过期或损坏时返回 false
+
+} // namespace engine::scene
@@ -0,0 +1,103 @@
+#pragma once
+#include <string>
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <SDL3/SDL_rect.h>
+#include <glm/vec2.hpp>
+#include "../utils/math.h"
+
+namespace engine::component {
+    enum class TileType : std::uint8_t;
+}
+
+namespace engine::scene {
+
+    /**
+     * @brief 关卡中一个动画的定义（来自瓦片的 "animation" 自定义属性）。
+     */
+    struct LevelAnimation {
+        std::string name;                   ///< @brief 动画名称
+        float frame_duration = 0.1f;        ///< @brief 每帧持续时间（秒）
+        int row = 0;                        ///< @brief 帧所在行
+        std::vector<int> frames;            ///< @brief 每帧所在列
+    };
+
+    /**
+     * @brief 关卡中用到的一种瓦片（一个 gid）的全部信息，已从图块集中解析完毕。
+     *
+     * 瓦片图层和对象都通过下标引用它，下标0保留给空瓦片。
+     */
+    struct LevelTileDef {
+        std::string texture_id;                         ///< @brief 纹理路径（为空表示没有图像）
+        std::optional<SDL_FRect> source_rect;           ///< @brief 纹理上的源矩形
+        engine::component::TileType type{};             ///< @brief 瓦片类型
+        std::optional<engine::utils::Rect> collider;    ///< @brief 自定义碰撞盒（相对于图片左上角）
+        std::optional<std::string> tag;                 ///< @brief 自定义属性 "tag"
+        std::optional<bool> gravity;                    ///< @brief 自定义属性 "gravity"
+        std::optional<int> health;                      ///< @brief 自定义属性 "health"
+        std::vector<LevelAnimation> animations;         ///< @brief 自定义属性 "animation" 解析出的动画
+        bool animation_invalid = false;                 ///< @brief "animation" 属性存在但解析失败（使用此瓦片的对象不会被创建）
+    };
+
+    /// @brief 图片图层（视差背景）
+    struct LevelImageLayer {
+        std::string name;                               ///< @brief 图层名称
+        std::string texture_id;                         ///< @brief 纹理路径
+        glm::vec2 offset = { 0.0f, 0.0f };              ///< @brief 图层偏移量
+        glm::vec2 scroll_factor = { 1.0f, 1.0f };       ///< @brief 视差因子
+        glm::bvec2 repeat = { false, false };           ///< @brief 是否重复
+    };
+
+    /// @brief 瓦片图层
+    struct LevelTileLayer {
+        std::string name;                               ///< @brief 图层名称
+        bool baked = true;                              ///< @brief 是否启用块烘焙
+        std::vector<std::uint32_t> tiles;               ///< @brief 每个格子的瓦片定义下标 (LevelData::tile_defs)，行优先
+    };
+
+    /// @brief 对象图层中的一个对象（生成记录）
+    struct LevelObject {
+        std::string name;                               ///< @brief 对象名称
+        std::uint32_t tile = 0;                         ///< @brief 瓦片定义下标
+        glm::vec2 position = { 0.0f, 0.0f };            ///< @brief Tiled 中的位置（左下角）
+        glm::vec2 size = { 0.0f, 0.0f };                ///< @brief 目标尺寸
+        float rotation = 0.0f;                          ///< @brief 旋转角度
+    };
+
+    /// @brief 对象图层
+    struct LevelObjectLayer {
+        std::string name;                               ///< @brief 图层名称
+        std::vector<LevelObject> objects;               ///< @brief 对象列表
+    };
+
+    /// @brief 图层类型，用于按原顺序重建图层
+    enum class LevelLayerKind : std::uint8_t {
+        IMAGE,
+        TILE,
+        OBJECT,
+    };
+
+    /// @brief 按地图中的顺序引用各类图层
+    struct LevelLayerRef {
+        LevelLayerKind kind = LevelLayerKind::IMAGE;    ///< @brief 图层类型
+        std::uint32_t index = 0;                        ///< @brief 在对应类型图层数组中的下标
+    };
+
+    /**
+     * @brief 解析完成的关卡数据，不再依赖 JSON。
+     *
+     * 由 LevelLoader 从 Tiled 文件（或编译后的二进制文件）得到，再据此创建游戏对象。
+     */
+    struct LevelData {
+        glm::ivec2 map_size = { 0, 0 };                 ///< @brief 地图尺寸（瓦片数量）
+        glm::ivec2 tile_size = { 0, 0 };                ///< @brief 瓦片尺寸（像素）
+        std::vector<LevelTileDef> tile_defs;            ///< @brief 关卡用到的瓦片定义（下标0为空瓦片）
+        std::vector<LevelImageLayer> image_layers;      ///< @brief 图片图层
+        std::vector<LevelTileLayer> tile_layers;        ///< @brief 瓦片图层
+        std::vector<LevelObjectLayer> object_layers;    ///< @brief 对象图层
+        std::vector<LevelLayerRef> layer_order;         ///< @brief 图层在地图中的顺序
+        std::vector<std::string> source_files;          ///< @brief 生成这些数据的源文件（地图及图块集），用于判断二进制文件是否过期
+    };
+
+} // namespace engine::scene
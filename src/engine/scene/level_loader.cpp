@@ -1,4 +1,6 @@
 #include "level_loader.h"
+#include "level_data.h"
+#include "level_binary.h"
 #include "../component/parallax_component.h"
 #include "../component/transform_component.h"
 #include "../component/tilelayer_component.h"
@@ -10,6 +12,7 @@
 #include "../object/game_object.h"
 #include "../scene/scene.h"
 #include "../core/context.h"
+#include "../core/profiler.h"
 #include "../resource/resource_manager.h"
 #include "../render/sprite.h"
 #include "../render/animation.h"
@@ -19,10 +22,59 @@
 #include <spdlog/spdlog.h>
 #include <glm/vec2.hpp>
 #include <filesystem>
+#include <algorithm>
+#include <unordered_set>
 
 namespace engine::scene {
 
     bool LevelLoader::loadLevel(const std::string& level_path, Scene& scene) {
+        ENGINE_PROFILE_SCOPE("LevelLoader::loadLevel");
+        // 1. 准备关卡数据
+        LevelData data;
+        if (!prepareLevel(level_path, data)) {
+            return false;
+        }
+
+        // 2. 根据关卡数据创建游戏对象
+        buildLevel(data, scene);
+        spdlog::info("关卡加载完成: {}", level_path);
+        return true;
+    }
+
+    bool LevelLoader::prepareLevel(const std::string& level_path, LevelData& data) {
+        ENGINE_PROFILE_SCOPE("LevelLoader::prepareLevel");
+        // 优先读取编译好的二进制关卡文件，不存在或已过期时再从 JSON 编译
+        const auto binary_path = getCompiledLevelPath(level_path);
+        if (use_binary_cache_ && loadCompiledLevel(binary_path, data)) {
+            return true;
+        }
+        if (!compileLevel(level_path, data)) {
+            return false;
+        }
+        if (use_binary_cache_) {
+            saveCompiledLevel(binary_path, data);   // 写入失败不影响本次加载
+        }
+        return true;
+    }
+
+    std::vector<std::string> LevelLoader::collectTexturePaths(const LevelData& data) {
+        std::vector<std::string> paths;
+        std::unordered_set<std::string> seen;
+        auto add = [&](const std::string& path) {
+            if (!path.empty() && seen.insert(path).second) {
+                paths.push_back(path);
+            }
+        };
+        for (const auto& layer : data.image_layers) {
+            add(layer.texture_id);
+        }
+        for (const auto& def : data.tile_defs) {
+            add(def.texture_id);
+        }
+        return paths;
+    }
+
+    bool LevelLoader::compileLevel(const std::string& level_path, LevelData& data) {
         // 1. 加载 JSON 文件
         std::ifstream file(level_path);
         if (!file.is_open()) {
@@ -44,6 +96,14 @@ namespace engine::scene {
         map_path_ = level_path;
         map_size_ = glm::ivec2(json_data.value("width", 0), json_data.value("height", 0));
         tile_size_ = glm::ivec2(json_data.value("tilewidth", 0), json_data.value("tileheight", 0));
+        tilesets_.clear();
+        gid_to_def_.clear();
+
+        data = LevelData{};
+        data.map_size = map_size_;
+        data.tile_size = tile_size_;
+        data.source_files.push_back(level_path);
+        data.tile_defs.emplace_back();          // 下标0保留给空瓦片
 
         // 4. 加载 tileset 数据
         if (json_data.contains("tilesets") && json_data["tilesets"].is_array()) {
@@ -56,10 +116,18 @@ namespace engine::scene {
                 auto tileset_path = resolvePath(tileset_json["source"], map_path_);  // 支持隐式转换，可以省略.get<T>()方法，
                 auto first_gid = tileset_json["firstgid"];
                 loadTileset(tileset_path, first_gid);
+                data.source_files.push_back(tileset_path);     // 图块集改变时二进制文件也需要重新生成
             }
         }
+        // gid 查找表覆盖所有图块集的范围，超出范围的 gid 视为无效
+        std::size_t gid_count = 1;
+        for (const auto& [first_gid, tileset] : tilesets_) {
+            gid_count = std::max(gid_count, static_cast<std::size_t>(first_gid) + tileset.tiles.size());
+        }
+        gid_to_def_.assign(gid_count, UNASSIGNED_DEF);
+        gid_to_def_[0] = 0;
 
-        // 5. 加载图层数据
+        // 5. 编译图层数据
         if (!json_data.contains("layers") || !json_data["layers"].is_array()) {       // 地图文件中必须有 layers 数组
             spdlog::error("地图文件 '{}' 中缺少或无效的 'layers' 数组。", level_path);
             return false;
@@ -72,213 +140,184 @@ namespace engine::scene {
                 continue;
             }
 
-            // 根据图层类型决定加载方法
+            // 根据图层类型决定编译方法
             if (layer_type == "imagelayer") {
-                loadImageLayer(layer_json, scene);
+                compileImageLayer(layer_json, data);
             }
             else if (layer_type == "tilelayer") {
-                loadTileLayer(layer_json, scene);
+                compileTileLayer(layer_json, data);
             }
             else if (layer_type == "objectgroup") {
-                loadObjectLayer(layer_json, scene);
+                compileObjectLayer(layer_json, data);
             }
             else {
                 spdlog::warn("不支持的图层类型: {}", layer_type);
             }
         }
 
-        spdlog::info("关卡加载完成: {}", level_path);
+        // 查找表只在编译阶段需要
+        tilesets_.clear();
+        gid_to_def_.clear();
+        spdlog::info("关卡编译完成: {}，瓦片定义 {} 个", level_path, data.tile_defs.size() - 1);
         return true;
     }
 
-    void LevelLoader::loadImageLayer(const nlohmann::json& layer_json, Scene& scene) {
+    void LevelLoader::compileImageLayer(const nlohmann::json& layer_json, LevelData& data) {
         // 获取纹理相对路径 （会自动处理'\/'符号）
         const std::string& image_path = layer_json.value("image", "");
         if (image_path.empty()) {
             spdlog::error("图层 '{}' 缺少 'image' 属性。", layer_json.value("name", "Unnamed"));
             return;
         }
-        auto texture_id = resolvePath(image_path, map_path_);
 
+        LevelImageLayer layer;
+        layer.texture_id = resolvePath(image_path, map_path_);
         // 获取图层偏移量（json中没有则代表未设置，给默认值即可）
-        const glm::vec2 offset = glm::vec2(layer_json.value("offsetx", 0.0f), layer_json.value("offsety", 0.0f));
-
+        layer.offset = glm::vec2(layer_json.value("offsetx", 0.0f), layer_json.value("offsety", 0.0f));
         // 获取视差因子及重复标志
-        const glm::vec2 scroll_factor = glm::vec2(layer_json.value("parallaxx", 1.0f), layer_json.value("parallaxy", 1.0f));
-        const glm::bvec2 repeat = glm::bvec2(layer_json.value("repeatx", false), layer_json.value("repeaty", false));
-
+        layer.scroll_factor = glm::vec2(layer_json.value("parallaxx", 1.0f), layer_json.value("parallaxy", 1.0f));
+        layer.repeat = glm::bvec2(layer_json.value("repeatx", false), layer_json.value("repeaty", false));
         // 获取图层名称
-        const std::string& layer_name = layer_json.value("name", "Unnamed");
+        layer.name = layer_json.value("name", "Unnamed");
 
         /*  可用类似方法获取其它各种属性，这里我们暂时用不上 */
 
-        // 创建游戏对象
-        auto game_object = std::make_unique<engine::object::GameObject>(layer_name);
-        // 依次添加Transform，Parallax组件
-        game_object->addComponent<engine::component::TransformComponent>(offset);
-        game_object->addComponent<engine::component::ParallaxComponent>(texture_id, scroll_factor, repeat);
-        // 添加到场景中
-        scene.addGameObject(std::move(game_object));
-        spdlog::info("加载图层: '{}' 完成", layer_name);
+        data.layer_order.push_back({ LevelLayerKind::IMAGE, static_cast<std::uint32_t>(data.image_layers.size()) });
+        data.image_layers.push_back(std::move(layer));
     }
 
-    void LevelLoader::loadTileLayer(const nlohmann::json& layer_json, Scene& scene)
+    void LevelLoader::compileTileLayer(const nlohmann::json& layer_json, LevelData& data)
     {
         if (!layer_json.contains("data") || !layer_json["data"].is_array()) {
             spdlog::error("图层 '{}' 缺少 'data' 属性。", layer_json.value("name", "Unnamed"));
             return;
         }
-        // 准备 TileInfo Vector (瓦片数量 = 地图宽度 * 地图高度)
-        std::vector<engine::component::TileInfo> tiles;
-        tiles.reserve(map_size_.x * map_size_.y);
-
-        // 获取图层数据 (瓦片 ID 列表)
-        const auto& data = layer_json["data"];
-
-        // 根据gid获取必要信息，并依次填充 TileInfo Vector
-        for (const auto& gid : data) {
-            tiles.push_back(getTileInfoByGid(gid));
+        LevelTileLayer layer;
+        layer.name = layer_json.value("name", "Unnamed");
+        // 瓦片图层默认是静态的，将分块烘焙为纹理渲染；可以通过图层的自定义属性 "baked" = false 关闭
+        layer.baked = getTileProperty<bool>(layer_json, "baked").value_or(true);
+
+        // 获取图层数据 (瓦片 ID 列表)，每个 gid 只在首次出现时查找图块集
+        const auto& gids = layer_json["data"];
+        layer.tiles.reserve(gids.size());
+        for (const auto& gid : gids) {
+            layer.tiles.push_back(getTileDefIndex(gid.get<int>(), data));
         }
 
-        // 获取图层名称
-        const std::string& layer_name = layer_json.value("name", "Unnamed");
-        // 创建游戏对象
-        auto game_object = std::make_unique<engine::object::GameObject>(layer_name);
-        // 添加Tilelayer组件
-        game_object->addComponent<engine::component::TileLayerComponent>(tile_size_, map_size_, std::move(tiles));
-        // 添加到场景中
-        scene.addGameObject(std::move(game_object));
-        spdlog::info("加载瓦片图层: '{}' 完成", layer_name);
+        data.layer_order.push_back({ LevelLayerKind::TILE, static_cast<std::uint32_t>(data.tile_layers.size()) });
+        data.tile_layers.push_back(std::move(layer));
     }
 
-    void LevelLoader::loadObjectLayer(const nlohmann::json& layer_json, Scene& scene)
+    void LevelLoader::compileObjectLayer(const nlohmann::json& layer_json, LevelData& data)
     {
         if (!layer_json.contains("objects") || !layer_json["objects"].is_array()) {
             spdlog::error("对象图层 '{}' 缺少 'objects' 属性。", layer_json.value("name", "Unnamed"));
             return;
         }
-        // 获取对象数据
-        const auto& objects = layer_json["objects"];
+        LevelObjectLayer layer;
+        layer.name = layer_json.value("name", "Unnamed");
         // 遍历对象数据
-        for (const auto& object : objects) {
+        for (const auto& object : layer_json["objects"]) {
             // 获取对象gid
             auto gid = object.value("gid", 0);
             if (gid == 0) {  // 如果gid为0 (即不存在)，则代表自己绘制的形状（可能是碰撞盒、触发器等，未来按需处理）
                 // TODO
-
+                continue;
+            }
+            // 如果gid存在，则按照图片解析流程
+            auto def_index = getTileDefIndex(gid, data);
+            const auto& def = data.tile_defs[def_index];
+            if (def.texture_id.empty()) {
+                spdlog::error("gid为 {} 的瓦片没有图像纹理。", gid);
+                continue;
+            }
+            if (!def.source_rect) {         // 正常情况下，所有瓦片的Sprite都设置了源矩形，没有代表某处出错
+                spdlog::error("gid为 {} 的瓦片没有源矩形。", gid);
+                continue;
             }
-            else {        // 如果gid存在，则按照图片解析流程
-                // --- 根据gid获取必要信息，每个gid对应一个游戏对象 ---
-                auto tile_info = getTileInfoByGid(gid);
-                if (tile_info.sprite.getTextureId().empty()) {
-                    spdlog::error("gid为 {} 的瓦片没有图像纹理。", gid);
-                    continue;
-                }
-                // 获取Transform相关信息
-                auto position = glm::vec2(object.value("x", 0.0f), object.value("y", 0.0f));
-                auto dst_size = glm::vec2(object.value("width", 0.0f), object.value("height", 0.0f));
-                position = glm::vec2(position.x, position.y - dst_size.y);  // 实际position需要进行调整(左下角到左上角)
-
-                auto rotation = object.value("rotation", 0.0f);
-                auto src_size_opt = tile_info.sprite.getSourceRect();
-                if (!src_size_opt) {        // 正常情况下，所有瓦片的Sprite都设置了源矩形，没有代表某处出错
-                    spdlog::error("gid为 {} 的瓦片没有源矩形。", gid);
-                    continue;
-                }
-                auto src_size = glm::vec2(src_size_opt->w, src_size_opt->h);    // 成员变量除了 value().w 外，也可以这样获取
-                auto scale = dst_size / src_size;
-
-                // 获取对象名称
-                const std::string& object_name = object.value("name", "Unnamed");
-
-                // 创建游戏对象并添加组件
-                auto game_object = std::make_unique<engine::object::GameObject>(object_name);
-                game_object->addComponent<engine::component::TransformComponent>(position, scale, rotation);
-                game_object->addComponent<engine::component::SpriteComponent>(std::move(tile_info.sprite), scene.getContext().getResourceManager());
-
-                // 获取瓦片json信息      1. 必然存在，因为getTileInfoByGid(gid)函数已经顺利执行
-                                    // 2. 这里再获取json，实际上检索了两次，未来可以优化
-                auto tile_json = getTileJsonByGid(gid);
-
-                // 获取碰信息：如果是SOLID类型，则添加物理组件，且图片源矩形区域就是碰撞盒大小
-                if (tile_info.type == engine::component::TileType::SOLID) {
-                    auto collider = std::make_unique<engine::physics::AABBCollider>(src_size);
-                    game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
-                    // 物理组件不受重力影响
-                    game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), false);
-                    // 设置标签方便物理引擎检索
-                    game_object->setTag("solid");
-                }
-                // 如果非SOLID类型，检查自定义碰撞盒是否存在
-                else if (auto rect = getColliderRect(tile_json); rect) {
-                    // 如果有，添加碰撞组件
-                    auto collider = std::make_unique<engine::physics::AABBCollider>(rect->size);
-                    auto* cc = game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
-                    cc->setOffset(rect->position);  // 自定义碰撞盒的坐标是相对于图片坐标，也就是针对Transform的偏移量
-                    // 和物理组件（默认不受重力影响）
-                    game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), false);
-                }
 
-                // 获取标签信息并设置
-                auto tag = getTileProperty<std::string>(tile_json, "tag");
-                if (tag) {
-                    game_object->setTag(tag.value());
-                }
-                // 如果是危险瓦片，且没有手动设置标签，则自动设置标签为 "hazard"
-                else if (tile_info.type == engine::component::TileType::HAZARD) {
-                    game_object->setTag("hazard");
-                }
+            LevelObject level_object;
+            level_object.name = object.value("name", "Unnamed");
+            level_object.tile = def_index;
+            level_object.position = glm::vec2(object.value("x", 0.0f), object.value("y", 0.0f));
+            level_object.size = glm::vec2(object.value("width", 0.0f), object.value("height", 0.0f));
+            level_object.rotation = object.value("rotation", 0.0f);
+            layer.objects.push_back(std::move(level_object));
+        }
 
-                // 获取重力信息并设置
-                auto gravity = getTileProperty<bool>(tile_json, "gravity");
-                if (gravity) {
-                    auto pc = game_object->getComponent<engine::component::PhysicsComponent>();
-                    if (pc) {
-                        pc->setUseGravity(gravity.value());
-                    }
-                    else {
-                        spdlog::warn("对象 '{}' 在设置重力信息时没有物理组件，请检查地图设置。", object_name);
-                        game_object->addComponent<engine::component::PhysicsComponent>(&scene.getContext().getPhysicsEngine(), gravity.value());
-                    }
-                }
+        data.layer_order.push_back({ LevelLayerKind::OBJECT, static_cast<std::uint32_t>(data.object_layers.size()) });
+        data.object_layers.push_back(std::move(layer));
+    }
 
-                // 获取动画信息并设置
-                auto anim_string = getTileProperty<std::string>(tile_json, "animation");
-                if (anim_string) {
-                    // 解析string为JSON对象
-                    nlohmann::json anim_json;
-                    try {
-                        anim_json = nlohmann::json::parse(anim_string.value());
-                    }
-                    catch (const nlohmann::json::parse_error& e) {
-                        spdlog::error("解析动画 JSON 字符串失败: {}", e.what());
-                        continue;  // 跳过此对象
-                    }
-                    // 添加AnimationComponent
-                    auto* ac = game_object->addComponent<engine::component::AnimationComponent>();
-                    // 添加动画到 AnimationComponent
-                    addAnimation(anim_json, ac, src_size);
-                }
+    std::uint32_t LevelLoader::getTileDefIndex(int gid, LevelData& data)
+    {
+        if (gid < 0 || static_cast<std::size_t>(gid) >= gid_to_def_.size()) {
+            spdlog::error("gid为 {} 的瓦片未找到图块集。", gid);
+            return 0;
+        }
+        auto& index = gid_to_def_[gid];
+        if (index == UNASSIGNED_DEF) {
+            // 首次出现的 gid：从图块集查找表复制瓦片定义，之后同一 gid 直接使用此下标
+            index = 0;
+            if (const auto* def = findTileDef(gid); def) {
+                index = static_cast<std::uint32_t>(data.tile_defs.size());
+                data.tile_defs.push_back(*def);
+            }
+        }
+        return index;
+    }
 
-                // 获取生命值信息并设置
-                auto health = getTileProperty<int>(tile_json, "health");
-                if (health) {
-                    // 添加 HealthComponent
-                    game_object->addComponent<engine::component::HealthComponent>(health.value());
-                }
+    const LevelTileDef* LevelLoader::findTileDef(int gid) const
+    {
+        // upper_bound：查找tilesets_中键大于 gid 的第一个元素，前移一个位置就得到不大于gid的最近一个元素（我们需要的）
+        auto tileset_it = tilesets_.upper_bound(gid);
+        if (tileset_it == tilesets_.begin()) {
+            spdlog::error("gid为 {} 的瓦片未找到图块集。", gid);
+            return nullptr;
+        }
+        --tileset_it;
+        const auto& tiles = tileset_it->second.tiles;
+        auto local_id = static_cast<std::size_t>(gid - tileset_it->first);     // 计算瓦片在图块集中的局部ID
+        if (local_id >= tiles.size() || tiles[local_id].texture_id.empty()) {
+            spdlog::error("图块集 '{}' 中未找到gid为 {} 的瓦片。", tileset_it->first, gid);
+            return nullptr;
+        }
+        return &tiles[local_id];
+    }
 
-                // 添加到场景中
-                scene.addGameObject(std::move(game_object));
-                spdlog::info("加载对象: '{}' 完成", object_name);
+    void LevelLoader::loadTileProperties(const nlohmann::json& tile_json, LevelTileDef& def)
+    {
+        // 瓦片类型
+        def.type = getTileType(tile_json);
+
+        // 自定义碰撞盒、标签、重力、生命值
+        def.collider = getColliderRect(tile_json);
+        def.tag = getTileProperty<std::string>(tile_json, "tag");
+        def.gravity = getTileProperty<bool>(tile_json, "gravity");
+        def.health = getTileProperty<int>(tile_json, "health");
+
+        // 获取动画信息（字符串形式的 JSON）
+        auto anim_string = getTileProperty<std::string>(tile_json, "animation");
+        if (anim_string) {
+            // 解析string为JSON对象
+            nlohmann::json anim_json;
+            try {
+                anim_json = nlohmann::json::parse(anim_string.value());
+            }
+            catch (const nlohmann::json::parse_error& e) {
+                spdlog::error("解析动画 JSON 字符串失败: {}", e.what());
+                def.animation_invalid = true;   // 使用此瓦片的对象将被跳过
+                return;
             }
+            parseAnimations(anim_json, def.animations);
         }
     }
 
-    void LevelLoader::addAnimation(const nlohmann::json& anim_json, engine::component::AnimationComponent* ac, const glm::vec2& sprite_size)
+    void LevelLoader::parseAnimations(const nlohmann::json& anim_json, std::vector<LevelAnimation>& animations)
     {
-        // 检查 anim_json 必须是一个对象，并且 ac 不能为 nullptr
-        if (!anim_json.is_object() || !ac) {
-            spdlog::error("无效的动画 JSON 或 AnimationComponent 指针。");
+        // 检查 anim_json 必须是一个对象
+        if (!anim_json.is_object()) {
+            spdlog::error("无效的动画 JSON。");
             return;
         }
         // 遍历动画 JSON 对象中的每个键值对（动画名称 : 动画信息）
@@ -289,37 +328,199 @@ namespace engine::scene {
                 spdlog::warn("动画 '{}' 的信息无效或为空。", anim_name);
                 continue;
             }
-            // 获取可能存在的动画帧信息
-            auto duration_ms = anim_info.value("duration", 100);        // 默认持续时间为100毫秒
-            auto duration = static_cast<float>(duration_ms) / 1000.0f;  // 转换为秒
-            auto row = anim_info.value("row", 0);                       // 默认行数为0
             // 帧信息（数组）是必须存在的
             if (!anim_info.contains("frames") || !anim_info["frames"].is_array()) {
                 spdlog::warn("动画 '{}' 缺少 'frames' 数组。", anim_name);
                 continue;
             }
-            // 创建一个Animation对象 (默认为循环播放)
-            auto animation = std::make_unique<engine::render::Animation>(anim_name);
+            LevelAnimation animation;
+            animation.name = anim_name;
+            // 获取可能存在的动画帧信息
+            auto duration_ms = anim_info.value("duration", 100);                        // 默认持续时间为100毫秒
+            animation.frame_duration = static_cast<float>(duration_ms) / 1000.0f;     // 转换为秒
+            animation.row = anim_info.value("row", 0);                                  // 默认行数为0
 
-            // 遍历数组并进行添加帧信息到animation对象
+            // 遍历数组，记录每一帧所在的列
             for (const auto& frame : anim_info["frames"]) {
                 if (!frame.is_number_integer()) {
                     spdlog::warn("动画 {} 中 frames 数组格式错误！", anim_name);
-                    continue;;
+                    continue;
                 }
-                auto column = frame.get<int>();
-                // 计算源矩形
-                SDL_FRect src_rect = {
-                    column * sprite_size.x,
-                    row * sprite_size.y,
-                    sprite_size.x,
-                    sprite_size.y
-                };
-                // 添加动画帧到 Animation
-                animation->addFrame(src_rect, duration);
+                animation.frames.push_back(frame.get<int>());
             }
-            // 将 Animation 对象添加到 AnimationComponent 中
-            ac->addAnimation(std::move(animation));
+            animations.push_back(std::move(animation));
+        }
+    }
+
+    void LevelLoader::buildLevel(const LevelData& data, Scene& scene)
+    {
+        ENGINE_PROFILE_SCOPE("LevelLoader::buildLevel");
+        map_size_ = data.map_size;
+        tile_size_ = data.tile_size;
+
+        // 每种瓦片的 TileInfo（含纹理句柄）只创建一次，瓦片图层按下标复制（不含字符串，复制开销很小）
+        auto& resource_manager = scene.getContext().getResourceManager();
+        std::vector<engine::component::TileInfo> tile_infos;
+        tile_infos.reserve(data.tile_defs.size());
+        for (const auto& def : data.tile_defs) {
+            if (def.texture_id.empty()) {
+                tile_infos.emplace_back();
+                continue;
+            }
+            tile_infos.emplace_back(engine::render::Sprite{ resource_manager, def.texture_id, def.source_rect }, def.type);
+        }
+
+        // 按照地图中的图层顺序创建游戏对象，图层序号作为 RenderLayer::TILES 层内的序号（决定渲染顺序）
+        for (int order = 0; const auto& ref : data.layer_order) {
+            switch (ref.kind) {
+            case LevelLayerKind::IMAGE:
+                if (ref.index < data.image_layers.size()) buildImageLayer(data.image_layers[ref.index], order, scene);
+                break;
+            case LevelLayerKind::TILE:
+                if (ref.index < data.tile_layers.size()) buildTileLayer(data.tile_layers[ref.index], data, tile_infos, order, scene);
+                break;
+            case LevelLayerKind::OBJECT:
+                if (ref.index < data.object_layers.size()) buildObjectLayer(data.object_layers[ref.index], data, order, scene);
+                break;
+            }
+            ++order;
+        }
+    }
+
+    void LevelLoader::buildImageLayer(const LevelImageLayer& layer, int order, Scene& scene)
+    {
+        // 创建游戏对象
+        auto game_object = std::make_unique<engine::object::GameObject>(layer.name);
+        game_object->setRenderLayer(engine::render::RenderLayer::TILES, order);
+        // 依次添加Transform，Parallax组件
+        game_object->addComponent<engine::component::TransformComponent>(layer.offset);
+        game_object->addComponent<engine::component::ParallaxComponent>(layer.texture_id, scene.getContext().getResourceManager(),
+                                                                        layer.scroll_factor, layer.repeat);
+        // 添加到场景中
+        scene.addGameObject(std::move(game_object));
+        spdlog::info("加载图层: '{}' 完成", layer.name);
+    }
+
+    void LevelLoader::buildTileLayer(const LevelTileLayer& layer, const LevelData& data,
+                                     const std::vector<engine::component::TileInfo>& tile_infos, int order, Scene& scene)
+    {
+        // 准备 TileInfo Vector (瓦片数量 = 地图宽度 * 地图高度)
+        std::vector<engine::component::TileInfo> tiles;
+        tiles.reserve(layer.tiles.size());
+        for (auto def_index : layer.tiles) {
+            tiles.push_back(def_index < tile_infos.size() ? tile_infos[def_index] : engine::component::TileInfo());
+        }
+
+        // 创建游戏对象
+        auto game_object = std::make_unique<engine::object::GameObject>(layer.name);
+        game_object->setRenderLayer(engine::render::RenderLayer::TILES, order);
+        // 添加Tilelayer组件
+        auto* tile_layer = game_object->addComponent<engine::component::TileLayerComponent>(data.tile_size, data.map_size, std::move(tiles));
+        tile_layer->setChunkBakingEnabled(layer.baked);
+        // 添加到场景中
+        scene.addGameObject(std::move(game_object));
+        spdlog::info("加载瓦片图层: '{}' 完成", layer.name);
+    }
+
+    void LevelLoader::buildObjectLayer(const LevelObjectLayer& layer, const LevelData& data, int order, Scene& scene)
+    {
+        auto& physics_engine = scene.getContext().getPhysicsEngine();
+        for (const auto& object : layer.objects) {
+            if (object.tile >= data.tile_defs.size()) {
+                spdlog::error("对象 '{}' 的瓦片定义下标 {} 无效。", object.name, object.tile);
+                continue;
+            }
+            const auto& def = data.tile_defs[object.tile];
+            if (def.texture_id.empty() || !def.source_rect) {   // 编译阶段已检查过，这里只防御损坏的数据
+                spdlog::error("对象 '{}' 的瓦片没有图像纹理或源矩形。", object.name);
+                continue;
+            }
+            // 如果动画属性解析失败，跳过此对象
+            if (def.animation_invalid) {
+                continue;
+            }
+
+            // 获取Transform相关信息
+            auto position = glm::vec2(object.position.x, object.position.y - object.size.y);  // 实际position需要进行调整(左下角到左上角)
+            auto src_size = glm::vec2(def.source_rect->w, def.source_rect->h);
+            auto scale = object.size / src_size;
+
+            // 创建游戏对象并添加组件
+            auto game_object = std::make_unique<engine::object::GameObject>(object.name);
+            game_object->setRenderLayer(engine::render::RenderLayer::TILES, order);     // 同一对象图层内的对象按纹理合并绘制
+            game_object->addComponent<engine::component::TransformComponent>(position, scale, object.rotation);
+            auto& resource_manager = scene.getContext().getResourceManager();
+            game_object->addComponent<engine::component::SpriteComponent>(engine::render::Sprite{ resource_manager, def.texture_id, def.source_rect },
+                                                                          resource_manager);
+
+            // 获取碰信息：如果是SOLID类型，则添加物理组件，且图片源矩形区域就是碰撞盒大小
+            if (def.type == engine::component::TileType::SOLID) {
+                auto collider = std::make_unique<engine::physics::AABBCollider>(src_size);
+                game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
+                // 物理组件不受重力影响
+                game_object->addComponent<engine::component::PhysicsComponent>(&physics_engine, false);
+                // 设置标签方便物理引擎检索
+                game_object->setTag("solid");
+            }
+            // 如果非SOLID类型，检查自定义碰撞盒是否存在
+            else if (def.collider) {
+                // 如果有，添加碰撞组件
+                auto collider = std::make_unique<engine::physics::AABBCollider>(def.collider->size);
+                auto* cc = game_object->addComponent<engine::component::ColliderComponent>(std::move(collider));
+                cc->setOffset(def.collider->position);  // 自定义碰撞盒的坐标是相对于图片坐标，也就是针对Transform的偏移量
+                // 和物理组件（默认不受重力影响）
+                game_object->addComponent<engine::component::PhysicsComponent>(&physics_engine, false);
+            }
+
+            // 设置标签
+            if (def.tag) {
+                game_object->setTag(def.tag.value());
+            }
+            // 如果是危险瓦片，且没有手动设置标签，则自动设置标签为 "hazard"
+            else if (def.type == engine::component::TileType::HAZARD) {
+                game_object->setTag("hazard");
+            }
+
+            // 设置重力信息
+            if (def.gravity) {
+                auto pc = game_object->getComponent<engine::component::PhysicsComponent>();
+                if (pc) {
+                    pc->setUseGravity(def.gravity.value());
+                }
+                else {
+                    spdlog::warn("对象 '{}' 在设置重力信息时没有物理组件，请检查地图设置。", object.name);
+                    game_object->addComponent<engine::component::PhysicsComponent>(&physics_engine, def.gravity.value());
+                }
+            }
+
+            // 添加动画（帧尺寸即源矩形尺寸）
+            if (!def.animations.empty()) {
+                auto* ac = game_object->addComponent<engine::component::AnimationComponent>();
+                for (const auto& anim : def.animations) {
+                    // 创建一个Animation对象 (默认为循环播放)
+                    auto animation = std::make_unique<engine::render::Animation>(anim.name);
+                    for (auto column : anim.frames) {
+                        // 计算源矩形
+                        SDL_FRect src_rect = {
+                            column * src_size.x,
+                            anim.row * src_size.y,
+                            src_size.x,
+                            src_size.y
+                        };
+                        animation->addFrame(src_rect, anim.frame_duration);
+                    }
+                    ac->addAnimation(std::move(animation));
+                }
+            }
+
+            // 设置生命值
+            if (def.health) {
+                game_object->addComponent<engine::component::HealthComponent>(def.health.value());
+            }
+
+            // 添加到场景中
+            scene.addGameObject(std::move(game_object));
+            spdlog::info("加载对象: '{}' 完成", object.name);
         }
     }
 
@@ -387,123 +588,6 @@ namespace engine::scene {
         return engine::component::TileType::NORMAL;
     }
 
-    engine::component::TileType LevelLoader::getTileTypeById(const nlohmann::json& tileset_json, int local_id)
-    {
-        if (tileset_json.contains("tiles")) {
-            auto& tiles = tileset_json["tiles"];
-            for (auto& tile : tiles) {
-                if (tile.contains("id") && tile["id"] == local_id) {
-                    return getTileType(tile);
-                }
-            }
-        }
-        return engine::component::TileType::NORMAL;
-    }
-
-    engine::component::TileInfo LevelLoader::getTileInfoByGid(int gid)
-    {
-        if (gid == 0) {
-            return engine::component::TileInfo();
-        }
-
-        // upper_bound：查找tileset_data_中键大于 gid 的第一个元素，返回迭代器
-        auto tileset_it = tileset_data_.upper_bound(gid);
-        if (tileset_it == tileset_data_.begin()) {
-            spdlog::error("gid为 {} 的瓦片未找到图块集。", gid);
-            return engine::component::TileInfo();
-        }
-        --tileset_it;  // 前移一个位置，这样就得到不大于gid的最近一个元素（我们需要的）
-
-        const auto& tileset = tileset_it->second;
-        auto local_id = gid - tileset_it->first;        // 计算瓦片在图块集中的局部ID
-        const std::string file_path = tileset.value("file_path", "");       // 获取图块集文件路径
-        if (file_path.empty()) {
-            spdlog::error("Tileset 文件 '{}' 缺少 'file_path' 属性。", tileset_it->first);
-            return engine::component::TileInfo();
-        }
-        // 图块集分为两种情况，需要分别考虑
-        if (tileset.contains("image")) {    // 这是单一图片的情况
-            // 获取图片路径
-            auto texture_id = resolvePath(tileset["image"].get<std::string>(), file_path);
-            // 计算瓦片在图片网格中的坐标
-            auto coordinate_x = local_id % tileset["columns"].get<int>();
-            auto coordinate_y = local_id / tileset["columns"].get<int>();
-            // 根据坐标确定源矩形
-            SDL_FRect texture_rect = {
-                static_cast<float>(coordinate_x * tile_size_.x),
-                static_cast<float>(coordinate_y * tile_size_.y),
-                static_cast<float>(tile_size_.x),
-                static_cast<float>(tile_size_.y)
-            };
-            engine::render::Sprite sprite{ texture_id, texture_rect };
-            auto tile_type = getTileTypeById(tileset, local_id);   // 获取瓦片类型（只有瓦片id，还没找具体瓦片json）
-            return engine::component::TileInfo(sprite, tile_type);
-        }
-        else {   // 这是多图片的情况
-            if (!tileset.contains("tiles")) {   // 没有tiles字段的话不符合数据格式要求，直接返回空的瓦片信息
-                spdlog::error("Tileset 文件 '{}' 缺少 'tiles' 属性。", tileset_it->first);
-                return engine::component::TileInfo();
-            }
-            // 遍历tiles数组，根据id查找对应的瓦片
-            const auto& tiles_json = tileset["tiles"];
-            for (const auto& tile_json : tiles_json) {
-                auto tile_id = tile_json.value("id", 0);
-                if (tile_id == local_id) {   // 找到对应的瓦片，进行后续操作
-                    if (!tile_json.contains("image")) {   // 没有image字段的话不符合数据格式要求，直接返回空的瓦片信息
-                        spdlog::error("Tileset 文件 '{}' 中瓦片 {} 缺少 'image' 属性。", tileset_it->first, tile_id);
-                        return engine::component::TileInfo();
-                    }
-                    // --- 接下来根据必要信息创建并返回 TileInfo ---
-                    // 获取图片路径
-                    auto texture_id = resolvePath(tile_json["image"].get<std::string>(), file_path);
-                    // 先确认图片尺寸
-                    auto image_width = tile_json.value("imagewidth", 0);
-                    auto image_height = tile_json.value("imageheight", 0);
-                    // 从json中获取源矩形信息
-                    SDL_FRect texture_rect = {      // tiled中源矩形信息只有设置了才会有值，没有就是默认值
-                        static_cast<float>(tile_json.value("x", 0)),
-                        static_cast<float>(tile_json.value("y", 0)),
-                        static_cast<float>(tile_json.value("width", image_width)),    // 如果未设置，则使用图片尺寸
-                        static_cast<float>(tile_json.value("height", image_height))
-                    };
-                    engine::render::Sprite sprite{ texture_id, texture_rect };
-                    auto tile_type = getTileType(tile_json);    // 获取瓦片类型（已经有具体瓦片json了）
-                    return engine::component::TileInfo(sprite, tile_type);
-                }
-            }
-        }
-        // 如果能走到这里，说明查找失败，返回空的瓦片信息
-        spdlog::error("图块集 '{}' 中未找到gid为 {} 的瓦片。", tileset_it->first, gid);
-        return engine::component::TileInfo();
-    }
-
-    std::optional<nlohmann::json> LevelLoader::getTileJsonByGid(int gid) const
-    {
-        // 1. 查找tileset_data_中键小于等于gid的最近元素
-        auto tileset_it = tileset_data_.upper_bound(gid);
-        if (tileset_it == tileset_data_.begin()) {
-            spdlog::error("gid为 {} 的瓦片未找到图块集。", gid);
-            return std::nullopt;
-        }
-        --tileset_it;
-        // 2. 获取图块集json对象
-        const auto& tileset = tileset_it->second;
-        auto local_id = gid - tileset_it->first;        // 计算瓦片在图块集中的局部ID
-        if (!tileset.contains("tiles")) {   // 没有tiles字段的话不符合数据格式要求，直接返回空
-            spdlog::error("Tileset 文件 '{}' 缺少 'tiles' 属性。", tileset_it->first);
-            return std::nullopt;
-        }
-        // 3. 遍历tiles数组，根据id查找对应的瓦片并返回瓦片json
-        const auto& tiles_json = tileset["tiles"];
-        for (const auto& tile_json : tiles_json) {
-            auto tile_id = tile_json.value("id", 0);
-            if (tile_id == local_id) {   // 找到对应的瓦片，返回瓦片json
-                return std::make_optional<nlohmann::json>(tile_json);
-            }
-        }
-        return std::nullopt;
-    }
-
     void LevelLoader::loadTileset(const std::string& tileset_path, int first_gid)
     {
         std::ifstream tileset_file(tileset_path);
@@ -520,9 +604,77 @@ namespace engine::scene {
             spdlog::error("解析 Tileset JSON 文件 '{}' 失败: {} (at byte {})", tileset_path, e.what(), e.byte);
             return;
         }
-        ts_json["file_path"] = tileset_path;    // 将文件路径存储到json中，后续解析图片路径时需要
-        tileset_data_[first_gid] = std::move(ts_json);
-        spdlog::info("Tileset 文件 '{}' 加载完成，firstgid: {}", tileset_path, first_gid);
+
+        // 按局部 ID 建立查找表：每个瓦片的纹理、源矩形、类型及自定义属性只在这里解析一次
+        TilesetTable table;
+        const nlohmann::json empty_tiles = nlohmann::json::array();
+        const auto& tiles_json = ts_json.contains("tiles") ? ts_json["tiles"] : empty_tiles;
+        // 图块集分为两种情况，需要分别考虑
+        if (ts_json.contains("image")) {    // 这是单一图片的情况
+            auto columns = ts_json.value("columns", 0);
+            if (columns <= 0 || tile_size_.x <= 0 || tile_size_.y <= 0) {
+                spdlog::error("Tileset 文件 '{}' 缺少有效的 'columns' 属性或地图瓦片尺寸无效。", tileset_path);
+                return;
+            }
+            // 获取图片路径（所有瓦片共用）
+            auto texture_id = resolvePath(ts_json["image"].get<std::string>(), tileset_path);
+            auto tile_count = ts_json.value("tilecount", columns * (ts_json.value("imageheight", 0) / tile_size_.y));
+            table.tiles.resize(std::max(tile_count, 0));
+            for (int local_id = 0; local_id < static_cast<int>(table.tiles.size()); ++local_id) {
+                auto& def = table.tiles[local_id];
+                def.texture_id = texture_id;
+                // 根据瓦片在图片网格中的坐标确定源矩形
+                def.source_rect = SDL_FRect{
+                    static_cast<float>(local_id % columns * tile_size_.x),
+                    static_cast<float>(local_id / columns * tile_size_.y),
+                    static_cast<float>(tile_size_.x),
+                    static_cast<float>(tile_size_.y)
+                };
+                def.type = engine::component::TileType::NORMAL;
+            }
+            // tiles 数组中只包含设置了属性的瓦片
+            for (const auto& tile_json : tiles_json) {
+                auto local_id = tile_json.value("id", -1);
+                if (local_id < 0 || local_id >= static_cast<int>(table.tiles.size())) continue;
+                loadTileProperties(tile_json, table.tiles[local_id]);
+            }
+        }
+        else {   // 这是多图片的情况
+            if (tiles_json.empty()) {   // 没有tiles字段的话不符合数据格式要求
+                spdlog::error("Tileset 文件 '{}' 缺少 'tiles' 属性。", tileset_path);
+                return;
+            }
+            int max_id = -1;
+            for (const auto& tile_json : tiles_json) {
+                max_id = std::max(max_id, tile_json.value("id", 0));
+            }
+            table.tiles.resize(max_id + 1);
+            for (const auto& tile_json : tiles_json) {
+                auto local_id = tile_json.value("id", 0);
+                if (local_id < 0) continue;
+                if (!tile_json.contains("image")) {   // 没有image字段的话不符合数据格式要求，此ID保留为空瓦片
+                    spdlog::error("Tileset 文件 '{}' 中瓦片 {} 缺少 'image' 属性。", tileset_path, local_id);
+                    continue;
+                }
+                auto& def = table.tiles[local_id];
+                // 获取图片路径
+                def.texture_id = resolvePath(tile_json["image"].get<std::string>(), tileset_path);
+                // 先确认图片尺寸
+                auto image_width = tile_json.value("imagewidth", 0);
+                auto image_height = tile_json.value("imageheight", 0);
+                // 从json中获取源矩形信息
+                def.source_rect = SDL_FRect{      // tiled中源矩形信息只有设置了才会有值，没有就是默认值
+                    static_cast<float>(tile_json.value("x", 0)),
+                    static_cast<float>(tile_json.value("y", 0)),
+                    static_cast<float>(tile_json.value("width", image_width)),    // 如果未设置，则使用图片尺寸
+                    static_cast<float>(tile_json.value("height", image_height))
+                };
+                loadTileProperties(tile_json, def);
+            }
+        }
+
+        spdlog::info("Tileset 文件 '{}' 加载完成，firstgid: {}，瓦片 {} 个", tileset_path, first_gid, table.tiles.size());
+        tilesets_[first_gid] = std::move(table);
     }
 
     std::string LevelLoader::resolvePath(const std::string& relative_path, const std::string& file_path)
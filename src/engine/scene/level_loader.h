@@ -3,13 +3,15 @@
 #include <glm/vec2.hpp>
 #include <nlohmann/json.hpp>
 #include <map>
+#include <vector>
 #include <optional>
+#include <cstdint>
+#include "level_data.h"
 #include "../utils/math.h"
 
 namespace engine::component {
-    class AnimationComponent;
     struct TileInfo;
-    enum class TileType;
+    enum class TileType : std::uint8_t;
 }
 
 namespace engine::scene {
@@ -17,12 +19,24 @@ namespace engine::scene {
 
     /**
      * @brief 负责从 Tiled JSON 文件 (.tmj) 加载关卡数据到 Scene 中。
+     *
+     * 加载分为两步：先把 JSON 编译为 LevelData（与 JSON 无关的关卡数据），再根据 LevelData 创建游戏对象。
+     * 编译结果会保存为二进制文件 (.lvlbin)，之后加载同一关卡时直接映射读取，跳过 JSON 解析。
      */
     class LevelLoader final {
         std::string map_path_;      ///< @brief 地图路径（拼接路径时需要）
         glm::ivec2 map_size_;       ///< @brief 地图尺寸(瓦片数量)
         glm::ivec2 tile_size_;      ///< @brief 瓦片尺寸(像素)
-        std::map<int, nlohmann::json> tileset_data_;    ///< @brief firstgid -> 瓦片集数据
+
+        /// @brief 预先解析好的图块集，按局部 ID 直接索引
+        struct TilesetTable {
+            std::vector<LevelTileDef> tiles;    ///< @brief 局部 ID -> 瓦片定义（纹理为空表示此 ID 没有瓦片）
+        };
+        static constexpr std::uint32_t UNASSIGNED_DEF = 0xFFFFFFFF;    ///< @brief gid 尚未分配瓦片定义
+
+        std::map<int, TilesetTable> tilesets_;          ///< @brief firstgid -> 图块集查找表
+        std::vector<std::uint32_t> gid_to_def_;         ///< @brief gid -> 瓦片定义下标 (LevelData::tile_defs)，编译时使用
+        bool use_binary_cache_ = true;                  ///< @brief 是否读写二进制关卡文件
 
     public:
         LevelLoader() = default;
@@ -35,18 +49,62 @@ namespace engine::scene {
          */
         [[nodiscard]] bool loadLevel(const std::string& map_path, Scene& scene);
 
+        /**
+         * @brief 准备关卡数据（读取二进制关卡文件，或从 JSON 编译并写入二进制文件）。不访问场景和渲染器，可在工作线程中调用。
+         * @param map_path Tiled JSON 地图文件的路径。
+         * @param data 输出的关卡数据。
+         * @return bool 是否成功。
+         */
+        [[nodiscard]] bool prepareLevel(const std::string& map_path, LevelData& data);
+
+        /// @brief 根据关卡数据创建游戏对象并添加到场景中（需在主线程调用）
+        void buildLevel(const LevelData& data, Scene& scene);
+
+        /// @brief 获取关卡用到的所有纹理路径（不重复），用于预先加载
+        static std::vector<std::string> collectTexturePaths(const LevelData& data);
+
+        void setUseBinaryCache(bool use_binary_cache) { use_binary_cache_ = use_binary_cache; }  ///< @brief 设置是否读写二进制关卡文件
+
     private:
-        void loadImageLayer(const nlohmann::json& layer_json, Scene& scene);    ///< @brief 加载图片图层
-        void loadTileLayer(const nlohmann::json& layer_json, Scene& scene);     ///< @brief 加载瓦片图层
-        void loadObjectLayer(const nlohmann::json& layer_json, Scene& scene);   ///< @brief 加载对象图层
+        // --- 编译阶段：Tiled JSON -> LevelData ---
+        [[nodiscard]] bool compileLevel(const std::string& map_path, LevelData& data);            ///< @brief 解析地图及图块集文件，生成关卡数据
+        void compileImageLayer(const nlohmann::json& layer_json, LevelData& data);              ///< @brief 编译图片图层
+        void compileTileLayer(const nlohmann::json& layer_json, LevelData& data);               ///< @brief 编译瓦片图层
+        void compileObjectLayer(const nlohmann::json& layer_json, LevelData& data);             ///< @brief 编译对象图层
+
+        /**
+         * @brief 获取 gid 对应的瓦片定义下标，首次遇到的 gid 会从图块集查找表复制瓦片定义。
+         * @param gid 全局 ID（0 或无效的 gid 对应下标0，即空瓦片）
+         * @param data 关卡数据（瓦片定义添加到此处）
+         * @return 瓦片定义下标
+         */
+        std::uint32_t getTileDefIndex(int gid, LevelData& data);
+
+        /**
+         * @brief 在图块集查找表中查找 gid 对应的瓦片定义
+         * @param gid 全局 ID
+         * @return 瓦片定义，找不到时返回 nullptr
+         */
+        const LevelTileDef* findTileDef(int gid) const;
 
         /**
-         * @brief 添加动画到指定的 AnimationComponent。
+         * @brief 解析瓦片json中的类型和自定义属性（碰撞盒、标签、重力、生命值、动画）到瓦片定义中
+         * @param tile_json 瓦片json数据
+         * @param def 瓦片定义
+         */
+        void loadTileProperties(const nlohmann::json& tile_json, LevelTileDef& def);
+
+        /**
+         * @brief 解析动画json数据。
          * @param anim_json 动画json数据（自定义）
-         * @param ac AnimationComponent 指针（动画添加到此组件）
-         * @param sprite_size 每一帧动画的尺寸
+         * @param animations 解析出的动画添加到此处
          */
-        void addAnimation(const nlohmann::json& anim_json, engine::component::AnimationComponent* ac, const glm::vec2& sprite_size);
+        void parseAnimations(const nlohmann::json& anim_json, std::vector<LevelAnimation>& animations);
+
+        // --- 创建阶段：LevelData -> 游戏对象 ---
+        void buildImageLayer(const LevelImageLayer& layer, int order, Scene& scene);            ///< @brief 创建图片图层（order 为图层在地图中的序号）
+        void buildTileLayer(const LevelTileLayer& layer, const LevelData& data, const std::vector<engine::component::TileInfo>& tile_infos, int order, Scene& scene);  ///< @brief 创建瓦片图层
+        void buildObjectLayer(const LevelObjectLayer& layer, const LevelData& data, int order, Scene& scene);  ///< @brief 创建对象图层中的游戏对象
 
         /**
          * @brief 获取瓦片属性
@@ -84,29 +142,7 @@ namespace engine::scene {
         engine::component::TileType getTileType(const nlohmann::json& tile_json);
 
         /**
-         * @brief 根据（单一图片）图块集中的id获取瓦片类型
-         * @param tileset_json 图块集json数据
-         * @param local_id 图块集中的id
-         * @return 瓦片类型
-         */
-        engine::component::TileType getTileTypeById(const nlohmann::json& tileset_json, int local_id);
-
-        /**
-         * @brief 根据全局 ID 获取瓦片信息。
-         * @param gid 全局 ID。
-         * @return engine::component::TileInfo 瓦片信息。
-         */
-        engine::component::TileInfo getTileInfoByGid(int gid);
-
-        /**
-         * @brief 根据全局 ID 获取瓦片json对象 (用于对象层获取瓦片信息)
-         * @param gid 全局 ID
-         * @return 瓦片json对象
-         */
-        std::optional<nlohmann::json> getTileJsonByGid(int gid) const;
-
-        /**
-         * @brief 加载 Tiled tileset 文件 (.tsj)。
+         * @brief 加载 Tiled tileset 文件 (.tsj)，并建立按局部 ID 索引的查找表。
          * @param tileset_path Tileset 文件路径。
          * @param first_gid 此 tileset 的第一个全局 ID。
          */
@@ -0,0 +1,43 @@
+#include "loading_scene.h"
+#include "scene_manager.h"
+#include "../core/context.h"
+#include "../render/renderer.h"
+#include <SDL3/SDL_render.h>
+#include <algorithm>
+#include "../core/log.h"
+#include <spdlog/spdlog.h>
+
+namespace engine::scene {
+
+    LoadingScene::LoadingScene(std::string name, engine::core::Context& context, engine::scene::SceneManager& scene_manager)
+        : Scene(std::move(name), context, scene_manager) {
+        ENGINE_LOG_TRACE("LoadingScene 构造完成。");
+    }
+
+    void LoadingScene::render() {
+        Scene::render();
+
+        auto& renderer = context_.getRenderer();
+        renderer.flush();       // 下面直接调用 SDL 绘制函数，先提交批处理内容
+        SDL_Renderer* sdl_renderer = renderer.getSDLRenderer();
+
+        // 进度条位于画面中央（使用逻辑分辨率，没有设置时使用输出尺寸）
+        int width = 0, height = 0;
+        SDL_RendererLogicalPresentation mode;
+        if (!SDL_GetRenderLogicalPresentation(sdl_renderer, &width, &height, &mode) || width == 0 || height == 0) {
+            SDL_GetCurrentRenderOutputSize(sdl_renderer, &width, &height);
+        }
+        const float progress = std::clamp(scene_manager_.getLoadProgress(), 0.0f, 1.0f);
+        const SDL_FRect frame = { width * 0.2f, height * 0.5f - 4.0f, width * 0.6f, 8.0f };
+        const SDL_FRect fill = { frame.x + 2.0f, frame.y + 2.0f, (frame.w - 4.0f) * progress, frame.h - 4.0f };
+
+        // 绘制后恢复原来的绘制颜色（清屏使用）
+        Uint8 r, g, b, a;
+        SDL_GetRenderDrawColor(sdl_renderer, &r, &g, &b, &a);
+        SDL_SetRenderDrawColor(sdl_renderer, 200, 200, 200, 255);
+        SDL_RenderRect(sdl_renderer, &frame);
+        SDL_RenderFillRect(sdl_renderer, &fill);
+        SDL_SetRenderDrawColor(sdl_renderer, r, g, b, a);
+    }
+
+} // namespace engine::scene
@@ -0,0 +1,16 @@
+#pragma once
+#include "scene.h"
+
+namespace engine::scene {
+
+    /**
+     * @brief 异步加载期间显示的轻量场景：不加载任何资源，只绘制一个进度条（进度来自 SceneManager::getLoadProgress）。
+     */
+    class LoadingScene final : public Scene {
+    public:
+        LoadingScene(std::string name, engine::core::Context& context, engine::scene::SceneManager& scene_manager);
+
+        void render() override;
+    };
+
+} // namespace engine::scene
@@ -1,74 +1,95 @@
 #include "scene.h"
 #include "scene_manager.h"
 #include "../object/game_object.h"
+#include "../object/component_registry.h"
+#include "../component/tilelayer_component.h"
 #include "../core/context.h"
 #include "../physics/physics_engine.h"
 #include "../render/camera.h"
-#include <algorithm> // for std::remove_if
+#include "../render/renderer.h"
+#include "../render/render_layer.h"
+#include <algorithm> // for std::sort, std::unique
+#include <memory_resource>
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::scene {
 
     Scene::Scene(std::string name, engine::core::Context& context, engine::scene::SceneManager& scene_manager)
-        : scene_name_(std::move(name)), context_(context), scene_manager_(scene_manager), is_initialized_(false) {
-        spdlog::trace("场景 '{}' 构造完成。", scene_name_);
+        : scene_name_(std::move(name)), context_(context), scene_manager_(scene_manager), is_initialized_(false),
+        component_registry_(std::make_unique<engine::object::ComponentRegistry>()) {
+        auto& counters = context_.getFrameCounters();
+        counter_ids_.objects_live = counters.registerCounter("scene.objects_live");
+        counter_ids_.objects_added = counters.registerCounter("scene.objects_added");
+        counter_ids_.objects_removed = counters.registerCounter("scene.objects_removed");
+        ENGINE_LOG_TRACE("场景 '{}' 构造完成。", scene_name_);
     }
 
     Scene::~Scene() = default;
 
+    void Scene::prepare(SceneLoader&) {
+    }
+
     void Scene::init() {
         is_initialized_ = true;     // 子类应该最后调用父类的 init 方法
-        spdlog::trace("场景 '{}' 初始化完成。", scene_name_);
+        ENGINE_LOG_TRACE("场景 '{}' 初始化完成。", scene_name_);
     }
 
     void Scene::update(float delta_time) {
         if (!is_initialized_) return;
 
+        updatePhysics(delta_time);
+        updateGameObjects(delta_time);
+    }
+
+    void Scene::updatePhysics(float delta_time) {
         // 先更新物理引擎
         context_.getPhysicsEngine().update(delta_time);
-        // 更新相机
-        context_.getCamera().update(delta_time);
-
-        // 更新所有游戏对象，并删除需要移除的对象
-        for (auto it = game_objects_.begin(); it != game_objects_.end();) {
-            if (*it && !(*it)->isNeedRemove()) {    // 正常更新游戏对象
-                (*it)->update(delta_time, context_);
-                ++it;
-            }
-            else {
-                if (*it) {      // 安全删除需要移除的对象
-                    (*it)->clean();
-                }
-                it = game_objects_.erase(it);   // 删除需要移除的对象，智能指针自动管理内存
+        // 更新相机 (跟随目标的插值位置)
+        context_.getCamera().update(delta_time, context_.getPhysicsEngine().getInterpolationAlpha());
+    }
+
+    void Scene::updateGameObjects(float delta_time) {
+        // 更新所有游戏对象 (需要移除的对象跳过，帧末统一删除)
+        for (size_t i = 0; i < game_objects_.size(); ++i) {
+            auto& obj = game_objects_[i];
+            if (obj && !obj->isNeedRemove()) {
+                obj->update(delta_time, context_);
             }
         }
+        // 再由组件系统按类型集中更新已登记的组件
+        component_registry_->update(delta_time, context_);
 
+        removeDeadObjects();            // 一次线性扫描删除本帧所有需要移除的对象
         processPendingAdditions();      // 处理待添加（延时添加）的游戏对象
+        context_.getFrameCounters().set(counter_ids_.objects_live, game_objects_.size());
     }
 
     void Scene::render() {
         if (!is_initialized_) return;
-        // 渲染所有游戏对象
+        // 渲染所有游戏对象：对象的 RenderLayer 映射为 Renderer 的渲染层（以当前层为基准，叠加场景/UI 因此仍在其上），
+        // 批处理模式下同一层内不同对象的精灵按纹理合并绘制
+        auto& renderer = context_.getRenderer();
+        const int base_layer = renderer.getRenderLayer() + 1;
         for (const auto& obj : game_objects_) {
-            if (obj) obj->render(context_);
+            if (!obj) continue;
+            renderer.setRenderLayer(base_layer + obj->getRenderLayer());
+            obj->render(context_);
         }
+        renderer.setRenderLayer(base_layer + engine::render::SCENE_RENDER_LAYER_SPAN);
     }
 
     void Scene::handleInput() {
         if (!is_initialized_) return;
 
-        // 遍历所有游戏对象，并删除需要移除的对象
-        for (auto it = game_objects_.begin(); it != game_objects_.end();) {
-            if (*it && !(*it)->isNeedRemove()) {
-                (*it)->handleInput(context_);
-                ++it;
-            }
-            else {
-                // 安全删除需要移除的对象
-                if (*it) (*it)->clean();
-                it = game_objects_.erase(it);
+        // 遍历所有游戏对象 (需要移除的对象跳过，在 update 末尾统一删除)
+        for (size_t i = 0; i < game_objects_.size(); ++i) {
+            auto& obj = game_objects_[i];
+            if (obj && !obj->isNeedRemove()) {
+                obj->handleInput(context_);
             }
         }
+        component_registry_->handleInput(context_);
     }
 
     void Scene::clean() {
@@ -78,13 +99,29 @@ namespace engine::scene {
             if (obj) obj->clean();
         }
         game_objects_.clear();
+        for (auto& [name, pool] : object_pools_) {
+            for (auto& obj : pool.free_objects) {
+                obj->clean();
+            }
+        }
+        object_pools_.clear();
+        name_index_.clear();
+        tag_index_.clear();
+        component_registry_->clear();
 
         is_initialized_ = false;        // 清理完成后，设置场景为未初始化
-        spdlog::trace("场景 '{}' 清理完成。", scene_name_);
+        ENGINE_LOG_TRACE("场景 '{}' 清理完成。", scene_name_);
     }
 
     void Scene::addGameObject(std::unique_ptr<engine::object::GameObject>&& game_object) {
-        if (game_object) game_objects_.push_back(std::move(game_object));
+        if (game_object) {
+            game_object->attachRegistry(component_registry_.get());
+            game_object->setScene(this);
+            name_index_[game_object->getName()].push_back(game_object.get());
+            tag_index_[game_object->getTag()].push_back(game_object.get());
+            game_objects_.push_back(std::move(game_object));
+            context_.getFrameCounters().add(counter_ids_.objects_added);
+        }
         else spdlog::warn("尝试向场景 '{}' 添加空游戏对象。", scene_name_);
     }
 
@@ -100,21 +137,13 @@ namespace engine::scene {
             return;
         }
 
-        // erase-remove 移除法不可用，因为智能指针与裸指针无法比较
-        // 需要使用 std::remove_if 和 lambda 表达式自定义比较的方式
-        auto it = std::remove_if(game_objects_.begin(), game_objects_.end(),
-            [game_object_ptr](const std::unique_ptr<engine::object::GameObject>& p) {
-                return p.get() == game_object_ptr;    // 比较裸指针是否相等（自定义比较方式）
-            });
-
-        if (it != game_objects_.end()) {
-            (*it)->clean();             // 因为传入的是指针，因此只可能有一个元素被移除，不需要遍历it到末尾
-            game_objects_.erase(it, game_objects_.end());   // 删除从it到末尾的元素（最后一个元素）
-            spdlog::trace("从场景 '{}' 中移除游戏对象。", scene_name_);
-        }
-        else {
+        // 只需确认对象属于本场景；索引和组件的清理（或回收）统一留给帧末的 removeDeadObjects，与 safeRemoveGameObject 相同
+        if (game_object_ptr->getScene() != this) {
             spdlog::warn("游戏对象指针未找到在场景 '{}' 中。", scene_name_);
+            return;
         }
+        game_object_ptr->setNeedRemove(true);
+        ENGINE_LOG_TRACE("从场景 '{}' 中移除游戏对象。", scene_name_);
     }
 
     void Scene::safeRemoveGameObject(engine::object::GameObject* game_object_ptr)
@@ -124,12 +153,132 @@ namespace engine::scene {
 
     engine::object::GameObject* Scene::findGameObjectByName(const std::string& name) const
     {
-        // 找到第一个符合条件的游戏对象就返回
+        // 同名对象按加入顺序存放，返回第一个
+        auto it = name_index_.find(name);
+        if (it != name_index_.end() && !it->second.empty()) {
+            return it->second.front();
+        }
+        return nullptr;
+    }
+
+    const std::vector<engine::object::GameObject*>& Scene::findGameObjectsByTag(const std::string& tag) const
+    {
+        static const std::vector<engine::object::GameObject*> empty;
+        auto it = tag_index_.find(tag);
+        return it != tag_index_.end() ? it->second : empty;
+    }
+
+    void Scene::onRenderTargetsReset(bool device_reset)
+    {
+        for (const auto& obj : game_objects_) {
+            if (auto* tile_layer = obj->getComponent<engine::component::TileLayerComponent>(); tile_layer) {
+                tile_layer->invalidateBakedChunks(device_reset);
+            }
+        }
+    }
+
+    void Scene::removeDeadObjects()
+    {
+        // 1. 从名称/标签索引中移除：收集受影响的索引列表（去重后每个列表只压缩一次），
+        //    大量同名/同标签对象（例如子弹）同时移除时也是线性的，而不是每个对象各做一次查找和删除
+        std::pmr::vector<std::vector<engine::object::GameObject*>*> touched_lists(&context_.getFrameArena());
         for (const auto& obj : game_objects_) {
-            if (obj && obj->getName() == name) {
-                return obj.get();
+            if (!obj || !obj->isNeedRemove()) continue;
+            if (auto it = name_index_.find(obj->getName()); it != name_index_.end()) touched_lists.push_back(&it->second);
+            if (auto it = tag_index_.find(obj->getTag()); it != tag_index_.end()) touched_lists.push_back(&it->second);
+        }
+        if (!touched_lists.empty()) {
+            std::sort(touched_lists.begin(), touched_lists.end());
+            touched_lists.erase(std::unique(touched_lists.begin(), touched_lists.end()), touched_lists.end());
+            for (auto* list : touched_lists) {
+                // 空列表保留在索引中，同名对象再次加入时不需要重新分配
+                std::erase_if(*list, [](const engine::object::GameObject* obj) { return obj->isNeedRemove(); });
+            }
+        }
+
+        // 2. 稳定压缩：保留的对象依次前移（保持顺序，即渲染顺序），需要移除的对象清理后释放。整体 O(n)
+        size_t keep = 0;
+        for (size_t i = 0; i < game_objects_.size(); ++i) {
+            auto& obj = game_objects_[i];
+            if (obj && !obj->isNeedRemove()) {
+                if (keep != i) game_objects_[keep] = std::move(obj);
+                ++keep;
+            }
+            else if (obj) {
+                obj->setScene(nullptr);
+                if (auto* pool = retireGameObject(obj.get()); pool) {
+                    pool->free_objects.push_back(std::move(obj));   // 放回对象池而不是销毁
+                }
+            }
+        }
+        context_.getFrameCounters().add(counter_ids_.objects_removed, game_objects_.size() - keep);
+        game_objects_.resize(keep);     // 剩余的都是空指针或已移走的对象，智能指针自动管理内存
+    }
+
+    void Scene::registerPrefab(const std::string& prefab_name, PrefabFactory factory, size_t prewarm_count)
+    {
+        if (!factory) {
+            spdlog::error("场景 '{}' 登记预制体 '{}' 失败：工厂为空。", scene_name_, prefab_name);
+            return;
+        }
+        auto& pool = object_pools_[prefab_name];
+        pool.factory = std::move(factory);
+        pool.free_objects.reserve(pool.free_objects.size() + prewarm_count);
+        for (size_t i = 0; i < prewarm_count; ++i) {
+            auto obj = pool.factory();
+            if (!obj) break;
+            obj->setPrefabName(prefab_name);
+            obj->releaseToPool();
+            pool.free_objects.push_back(std::move(obj));
+        }
+        ENGINE_LOG_TRACE("场景 '{}' 登记预制体 '{}'，预创建 {} 个对象。", scene_name_, prefab_name, pool.free_objects.size());
+    }
+
+    engine::object::GameObject* Scene::spawnFromPool(const std::string& prefab_name)
+    {
+        auto it = object_pools_.find(prefab_name);
+        if (it == object_pools_.end()) {
+            spdlog::error("场景 '{}' 中未登记预制体 '{}'。", scene_name_, prefab_name);
+            return nullptr;
+        }
+
+        auto& pool = it->second;
+        std::unique_ptr<engine::object::GameObject> obj;
+        if (!pool.free_objects.empty()) {   // 复用闲置对象
+            obj = std::move(pool.free_objects.back());
+            pool.free_objects.pop_back();
+            obj->acquireFromPool();
+        }
+        else {                              // 池已空，创建新对象（之后同样会被回收）
+            obj = pool.factory();
+            if (!obj) {
+                spdlog::error("预制体 '{}' 的工厂未能创建对象。", prefab_name);
+                return nullptr;
+            }
+            obj->setPrefabName(prefab_name);
+        }
+
+        auto* ptr = obj.get();
+        safeAddGameObject(std::move(obj));
+        return ptr;
+    }
+
+    size_t Scene::getFreePooledCount(const std::string& prefab_name) const
+    {
+        auto it = object_pools_.find(prefab_name);
+        return it != object_pools_.end() ? it->second.free_objects.size() : 0;
+    }
+
+    Scene::ObjectPool* Scene::retireGameObject(engine::object::GameObject* game_object)
+    {
+        if (!game_object->getPrefabName().empty()) {
+            auto it = object_pools_.find(game_object->getPrefabName());
+            if (it != object_pools_.end()) {
+                game_object->releaseToPool();
+                return &it->second;
             }
         }
+        game_object->clean();
         return nullptr;
     }
 
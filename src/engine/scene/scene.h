@@ -2,6 +2,9 @@
 #include <vector>
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <functional>
+#include "../core/frame_counters.h"
 
 namespace engine::core {
     class Context;
@@ -18,10 +21,12 @@ namespace engine::input {
 
 namespace engine::object {
     class GameObject;
+    class ComponentRegistry;
 }
 
 namespace engine::scene {
     class SceneManager;
+    class SceneLoader;
 
     /**
      * @brief 场景基类，负责管理场景中的游戏对象和场景生命周期。
@@ -30,13 +35,37 @@ namespace engine::scene {
      * 派生类应实现具体的场景逻辑。
      */
     class Scene {
+    public:
+        /// @brief 预制体工厂：创建一个完整配置（已添加所有组件）的游戏对象
+        using PrefabFactory = std::function<std::unique_ptr<engine::object::GameObject>()>;
+
     protected:
+        /// @brief 某个预制体的对象池：工厂及闲置对象
+        struct ObjectPool {
+            PrefabFactory factory;                                                  ///< @brief 闲置对象不足时用于创建新对象
+            std::vector<std::unique_ptr<engine::object::GameObject>> free_objects;  ///< @brief 已回收的闲置对象
+        };
+
         std::string scene_name_;                            ///< @brief 场景名称
         engine::core::Context& context_;                    ///< @brief 上下文引用（隐式，构造时传入）
         engine::scene::SceneManager& scene_manager_;        ///< @brief 场景管理器引用（构造时传入）
         bool is_initialized_ = false;                       ///< @brief 场景是否已初始化(非当前场景很可能未被删除，因此需要初始化标志避免重复初始化)
+        std::unique_ptr<engine::object::ComponentRegistry> component_registry_;        ///< @brief 组件系统注册表（需在 game_objects_ 之前声明，最后销毁）
         std::vector<std::unique_ptr<engine::object::GameObject>> game_objects_;         ///< @brief 场景中的游戏对象
         std::vector<std::unique_ptr<engine::object::GameObject>> pending_additions_;    ///< @brief 待添加的游戏对象（延时添加）
+        /// @brief 名称 -> 同名对象（按加入顺序），加入/移除场景时同步维护
+        std::unordered_map<std::string, std::vector<engine::object::GameObject*>> name_index_;
+        /// @brief 标签 -> 同标签对象（按加入顺序），加入/移除场景时同步维护
+        std::unordered_map<std::string, std::vector<engine::object::GameObject*>> tag_index_;
+        std::unordered_map<std::string, ObjectPool> object_pools_;  ///< @brief 预制体名称 -> 对象池
+
+        /// @brief 注册到 FrameCounters 的计数器编号（所有场景共用同名计数器）
+        struct CounterIds {
+            engine::core::CounterId objects_live = 0;       ///< @brief 更新结束时场景中的对象数量
+            engine::core::CounterId objects_added = 0;      ///< @brief 加入场景的对象数量
+            engine::core::CounterId objects_removed = 0;    ///< @brief 从场景中删除（或回收到对象池）的对象数量
+        };
+        CounterIds counter_ids_;                                    ///< @brief 计数器编号
 
     public:
         /**
@@ -57,6 +86,12 @@ namespace engine::scene {
         Scene(Scene&&) = delete;
         Scene& operator=(Scene&&) = delete;
 
+        /**
+         * @brief 异步加载时在工作线程中调用（早于 init），用于解析数据、通过 loader 解码图片。默认什么都不做。
+         * @note 运行在工作线程中：不得访问渲染器、资源管理器、物理引擎等，也不得添加游戏对象（这些留到 init 中进行）。
+         */
+        virtual void prepare(SceneLoader& loader);
+
         // 核心循环方法
         virtual void init();                        ///< @brief 初始化场景。
         virtual void update(float delta_time);      ///< @brief 更新场景。
@@ -70,7 +105,7 @@ namespace engine::scene {
         /// @brief 安全地添加游戏对象。（添加到pending_additions_中）
         virtual void safeAddGameObject(std::unique_ptr<engine::object::GameObject>&& game_object);
 
-        /// @brief 直接从场景中移除一个游戏对象。（一般不使用，但保留实现的逻辑）
+        /// @brief 从场景中移除一个游戏对象：确认对象属于本场景后标记删除，在帧末的压缩中统一移出索引并清理（或回收）
         virtual void removeGameObject(engine::object::GameObject* game_object_ptr);
 
         /// @brief 安全地移除游戏对象。（设置need_remove_标记）
@@ -79,9 +114,39 @@ namespace engine::scene {
         /// @brief 获取场景中的游戏对象容器。
         const std::vector<std::unique_ptr<engine::object::GameObject>>& getGameObjects() const { return game_objects_; }
 
-        /// @brief 根据名称查找游戏对象（返回找到的第一个对象）。
+        /**
+         * @brief 登记预制体对象池。
+         * @param prefab_name 预制体名称（对象池的键）
+         * @param factory 创建该预制体对象的工厂
+         * @param prewarm_count 预先创建并放入池中的对象数量
+         */
+        void registerPrefab(const std::string& prefab_name, PrefabFactory factory, size_t prewarm_count = 0);
+
+        /**
+         * @brief 从对象池取出（没有闲置对象时新建）一个对象，并安全地添加到场景中（同 safeAddGameObject）。
+         *
+         * 对象被移除时（setNeedRemove / removeGameObject）不会销毁，而是回收到池中，稳定运行时不再分配内存。
+         * 取出的对象已通过 onAcquire 恢复初始状态，调用者通常只需设置位置等参数。
+         * @return 对象指针（非拥有），预制体未登记或创建失败时返回 nullptr
+         */
+        engine::object::GameObject* spawnFromPool(const std::string& prefab_name);
+
+        /// @brief 获取某个预制体对象池中闲置对象的数量
+        size_t getFreePooledCount(const std::string& prefab_name) const;
+
+        /// @brief 根据名称查找游戏对象（返回最先加入的同名对象）。
+        /// @note 使用加入场景时的名称建立索引，加入后再修改名称/标签不会反映到查找结果中。
         engine::object::GameObject* findGameObjectByName(const std::string& name) const;
 
+        /// @brief 获取具有指定标签的所有游戏对象（按加入顺序）。
+        const std::vector<engine::object::GameObject*>& findGameObjectsByTag(const std::string& tag) const;
+
+        /**
+         * @brief 渲染目标内容丢失时调用：让场景中所有瓦片图层重新烘焙块纹理。
+         * @param device_reset 渲染设备是否已重置（为 true 时释放并重新创建块纹理）
+         */
+        virtual void onRenderTargetsReset(bool device_reset);
+
         // getters and setters
         void setName(const std::string& name) { scene_name_ = name; }               ///< @brief 设置场景名称
         const std::string& getName() const { return scene_name_; }                  ///< @brief 获取场景名称
@@ -90,10 +155,18 @@ namespace engine::scene {
 
         engine::core::Context& getContext() const { return context_; }                  ///< @brief 获取上下文引用
         engine::scene::SceneManager& getSceneManager() const { return scene_manager_; } ///< @brief 获取场景管理器引用
+        /// @brief 获取组件系统注册表（派生类在构造函数中登记系统，见 ComponentRegistry::registerSystem）
+        engine::object::ComponentRegistry& getComponentRegistry() const { return *component_registry_; }
         std::vector<std::unique_ptr<engine::object::GameObject>>& getGameObjects() { return game_objects_; } ///< @brief 获取场景中的游戏对象
 
     protected:
+        // update 的两个步骤，派生类可以分别调用（例如分别计时）
+        void updatePhysics(float delta_time);       ///< @brief 更新物理引擎和相机
+        void updateGameObjects(float delta_time);   ///< @brief 更新游戏对象和组件系统，并处理待删除/待添加的对象
         void processPendingAdditions();     ///< @brief 处理待添加的游戏对象。（每轮更新的最后调用）
+        void removeDeadObjects();           ///< @brief 一次性删除所有标记为需要移除的对象（稳定压缩，O(n)）。（每轮更新末尾调用）
+        /// @brief 退役一个对象：属于对象池则回收 (releaseToPool)，否则清理 (clean)。返回对象所属的池（不属于则为空）
+        ObjectPool* retireGameObject(engine::object::GameObject* game_object);
     };
 
 } // namespace engine::scene
@@ -0,0 +1,100 @@
+#include "scene_loader.h"
+#include "scene.h"
+#include "../resource/resource_manager.h"
+#include "../core/profiler.h"
+#include "../core/log.h"
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <exception>
+#include <iterator>
+
+namespace engine::scene {
+
+    SceneLoader::SceneLoader(std::unique_ptr<Scene>&& scene) : scene_(std::move(scene)) {
+    }
+
+    SceneLoader::~SceneLoader() {
+        cancelled_ = true;
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+    }
+
+    void SceneLoader::start() {
+        if (!scene_ || worker_.joinable()) return;
+        ENGINE_LOG_DEBUG("开始在后台加载场景 '{}' 。", scene_->getName());
+        worker_ = std::thread(&SceneLoader::run, this);
+    }
+
+    void SceneLoader::run() {
+        ENGINE_PROFILE_THREAD_NAME("SceneLoader");
+        ENGINE_PROFILE_SCOPE("SceneLoader::prepare");
+        try {
+            scene_->prepare(*this);
+        }
+        catch (const std::exception& e) {
+            // 准备失败时场景仍会被 init（通常会退回到同步加载）
+            spdlog::error("后台准备场景 '{}' 失败: {}", scene_->getName(), e.what());
+        }
+        worker_done_ = true;
+    }
+
+    void SceneLoader::decodeTexture(const std::string& file_path) {
+        decodeTextures({ file_path });
+    }
+
+    void SceneLoader::decodeTextures(const std::vector<std::string>& file_paths) {
+        if (cancelled_) return;
+        std::vector<std::string> new_paths;
+        for (const auto& file_path : file_paths) {
+            if (requested_.insert(file_path).second) {
+                new_paths.push_back(file_path);
+            }
+        }
+        if (new_paths.empty()) return;
+        requested_count_ += new_paths.size();
+
+        // 解码失败（surface 为空）的图片仍然放入队列，上传时跳过，保证进度能够走完
+        auto images = engine::resource::decodeImages(new_paths, 0, &cancelled_);
+        std::lock_guard lock(mutex_);
+        std::move(images.begin(), images.end(), std::back_inserter(decoded_));
+    }
+
+    bool SceneLoader::uploadPending(engine::resource::ResourceManager& resource_manager, size_t max_uploads) {
+        // 先读取结束标志：之后取到的队列一定包含工作线程的全部结果
+        bool worker_done = worker_done_;
+
+        std::vector<engine::resource::DecodedImage> batch;
+        {
+            std::lock_guard lock(mutex_);
+            auto count = std::min(max_uploads, decoded_.size());
+            batch.reserve(count);
+            std::move(decoded_.begin(), decoded_.begin() + count, std::back_inserter(batch));
+            decoded_.erase(decoded_.begin(), decoded_.begin() + count);
+        }
+        for (auto& image : batch) {
+            if (image.surface) {
+                resource_manager.loadTextureFromSurface(image.file_path, image.surface.get());
+            }
+            ++uploaded_count_;
+        }
+        return worker_done && uploaded_count_ == requested_count_;
+    }
+
+    float SceneLoader::getProgress() const {
+        auto requested = requested_count_.load();
+        float upload_progress = requested > 0 ? static_cast<float>(uploaded_count_) / static_cast<float>(requested) : 0.0f;
+        if (!worker_done_) {
+            return std::min(upload_progress, 1.0f) * 0.5f;
+        }
+        return 0.5f + (requested > 0 ? upload_progress : 1.0f) * 0.5f;
+    }
+
+    std::unique_ptr<Scene> SceneLoader::takeScene() {
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+        return std::move(scene_);
+    }
+
+} // namespace engine::scene
@@ -0,0 +1,72 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+#include "../resource/image_decoder.h"
+
+namespace engine::resource {
+    class ResourceManager;
+}
+
+namespace engine::scene {
+    class Scene;
+
+    /**
+     * @brief 在后台线程中准备一个场景（异步加载）。
+     *
+     * 工作线程调用 Scene::prepare 解析数据，并通过 decodeTexture 把图片解码为 SDL_Surface；
+     * 主线程每帧调用 uploadPending，把已解码的图片分批上传为纹理（SDL 渲染器只能在主线程使用）。
+     * 全部完成后由 SceneManager 取出场景，在主线程中 init（此时纹理已在缓存中，不再读盘）。
+     */
+    class SceneLoader final {
+    private:
+        std::unique_ptr<Scene> scene_;                  ///< @brief 正在加载的场景（完成前只由工作线程访问）
+        std::thread worker_;                            ///< @brief 工作线程
+        std::atomic<bool> worker_done_ = false;         ///< @brief 工作线程是否已结束
+        std::atomic<bool> cancelled_ = false;           ///< @brief 是否已取消（析构时设置，工作线程尽快退出）
+
+        std::mutex mutex_;                              ///< @brief 保护 decoded_
+        std::vector<engine::resource::DecodedImage> decoded_;   ///< @brief 已解码、等待上传的图片（工作线程写入，主线程取出）
+        std::unordered_set<std::string> requested_;     ///< @brief 已请求解码的路径（只由工作线程访问，用于去重）
+        std::atomic<size_t> requested_count_ = 0;       ///< @brief 已请求解码的图片数量
+        size_t uploaded_count_ = 0;                     ///< @brief 已上传（或放弃）的图片数量（只由主线程访问）
+
+    public:
+        explicit SceneLoader(std::unique_ptr<Scene>&& scene);
+        ~SceneLoader();     ///< @brief 取消加载并等待工作线程结束
+
+        // 禁止拷贝和移动（工作线程持有 this）
+        SceneLoader(const SceneLoader&) = delete;
+        SceneLoader& operator=(const SceneLoader&) = delete;
+        SceneLoader(SceneLoader&&) = delete;
+        SceneLoader& operator=(SceneLoader&&) = delete;
+
+        void start();       ///< @brief 启动工作线程
+
+        // --- 工作线程调用 ---
+        /// @brief 在当前（工作）线程解码图片，之后由主线程上传为纹理。重复的路径会被忽略
+        void decodeTexture(const std::string& file_path);
+        /// @brief 并行解码一组图片（预加载清单，见 engine::resource::decodeImages），之后由主线程上传为纹理
+        void decodeTextures(const std::vector<std::string>& file_paths);
+        bool isCancelled() const { return cancelled_; }    ///< @brief 加载是否已取消（prepare 中耗时的步骤可据此提前结束）
+
+        // --- 主线程调用 ---
+        /**
+         * @brief 上传已解码的图片为纹理。
+         * @param resource_manager 资源管理器（纹理上传后缓存到这里）
+         * @param max_uploads 本次最多上传的数量（把上传分摊到多帧，避免卡顿）
+         * @return 工作线程已结束且所有图片已上传时返回 true
+         */
+        bool uploadPending(engine::resource::ResourceManager& resource_manager, size_t max_uploads);
+        float getProgress() const;                      ///< @brief 获取加载进度 [0, 1]（工作线程结束前最多0.5，其余按上传进度计算）
+        std::unique_ptr<Scene> takeScene();             ///< @brief 等待工作线程结束并取出场景
+
+    private:
+        void run();         ///< @brief 工作线程入口
+    };
+
+} // namespace engine::scene
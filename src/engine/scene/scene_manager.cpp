@@ -1,17 +1,21 @@
 #include "scene_manager.h"
 #include "scene.h"
+#include "scene_loader.h"
 #include "../core/context.h"
+#include "../core/profiler.h"
+
+#include "../core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace engine::scene {
 
     SceneManager::SceneManager(engine::core::Context& context)
         : context_(context) {
-        spdlog::trace("场景管理器已创建。");
+        ENGINE_LOG_TRACE("场景管理器已创建。");
     }
 
     SceneManager::~SceneManager() {
-        spdlog::trace("场景管理器已销毁。");
+        ENGINE_LOG_TRACE("场景管理器已销毁。");
         close(); // 即使不手动调用 close 也能确保清理
     }
 
@@ -23,6 +27,7 @@ namespace engine::scene {
     }
 
     void SceneManager::update(float delta_time) {
+        ENGINE_PROFILE_SCOPE("SceneManager::update");
         // 只更新栈顶（当前）场景
         Scene* current_scene = getCurrentScene();
         if (current_scene) {
@@ -30,9 +35,12 @@ namespace engine::scene {
         }
         // 执行可能的切换场景操作
         processPendingActions();
+        // 推进后台加载
+        updateLoading();
     }
 
     void SceneManager::render() {
+        ENGINE_PROFILE_SCOPE("SceneManager::render");
         // 渲染时需要叠加渲染所有场景，而不只是栈顶
         for (const auto& scene : scene_stack_) {
             if (scene) {
@@ -49,12 +57,23 @@ namespace engine::scene {
         }
     }
 
+    void SceneManager::onRenderTargetsReset(bool device_reset) {
+        // 栈中所有场景都会渲染，因此都需要处理
+        for (const auto& scene : scene_stack_) {
+            if (scene) {
+                scene->onRenderTargetsReset(device_reset);
+            }
+        }
+    }
+
     void SceneManager::close() {
-        spdlog::trace("正在关闭场景管理器并清理场景栈...");
+        ENGINE_LOG_TRACE("正在关闭场景管理器并清理场景栈...");
+        // 先取消后台加载（等待工作线程结束）
+        loader_.reset();
         // 清理栈中所有剩余的场景（从顶到底）
         while (!scene_stack_.empty()) {
             if (scene_stack_.back()) {
-                spdlog::debug("正在清理场景 '{}' 。", scene_stack_.back()->getName());
+                ENGINE_LOG_DEBUG("正在清理场景 '{}' 。", scene_stack_.back()->getName());
                 scene_stack_.back()->clean();
             }
             scene_stack_.pop_back();
@@ -78,8 +97,42 @@ namespace engine::scene {
         pending_scene_ = std::move(scene);
     }
 
+    void SceneManager::requestLoadScene(std::unique_ptr<Scene>&& scene, std::unique_ptr<Scene>&& loading_scene)
+    {
+        if (!scene) {
+            spdlog::warn("尝试异步加载空场景。");
+            return;
+        }
+        if (loader_) {
+            spdlog::warn("已有场景正在加载，取消并改为加载场景 '{}' 。", scene->getName());
+        }
+        loader_ = std::make_unique<SceneLoader>(std::move(scene));
+        loader_->start();
+        if (loading_scene) {
+            requestReplaceScene(std::move(loading_scene));
+        }
+    }
+
+    float SceneManager::getLoadProgress() const
+    {
+        return loader_ ? loader_->getProgress() : 1.0f;
+    }
+
     // --- Private Methods ---
 
+    void SceneManager::updateLoading()
+    {
+        if (!loader_) return;
+        if (!loader_->uploadPending(context_.getResourceManager(), texture_uploads_per_frame_)) {
+            return;
+        }
+        // 工作线程已结束、纹理已全部上传：下一帧切换到加载好的场景（init 在主线程中进行）
+        auto scene = loader_->takeScene();
+        loader_.reset();
+        ENGINE_LOG_DEBUG("场景 '{}' 后台加载完成。", scene->getName());
+        requestReplaceScene(std::move(scene));
+    }
+
     void SceneManager::processPendingActions()
     {
         if (pending_action_ == PendingAction::None) {
@@ -108,7 +161,7 @@ namespace engine::scene {
             spdlog::warn("尝试将空场景压入栈。");
             return;
         }
-        spdlog::debug("正在将场景 '{}' 压入栈。", scene->getName());
+        ENGINE_LOG_DEBUG("正在将场景 '{}' 压入栈。", scene->getName());
 
         // 初始化新场景
         if (!scene->isInitialized()) { // 确保只初始化一次
@@ -124,7 +177,7 @@ namespace engine::scene {
             spdlog::warn("尝试从空场景栈中弹出。");
             return;
         }
-        spdlog::debug("正在从栈中弹出场景 '{}' 。", scene_stack_.back()->getName());
+        ENGINE_LOG_DEBUG("正在从栈中弹出场景 '{}' 。", scene_stack_.back()->getName());
 
         // 清理并移除栈顶场景
         if (scene_stack_.back()) {
@@ -138,7 +191,8 @@ namespace engine::scene {
             spdlog::warn("尝试用空场景替换。");
             return;
         }
-        spdlog::debug("正在用场景 '{}' 替换场景 '{}' 。", scene->getName(), scene_stack_.back()->getName());
+        ENGINE_LOG_DEBUG("正在用场景 '{}' 替换场景 '{}' 。", scene->getName(),
+                      scene_stack_.empty() ? std::string("<空>") : scene_stack_.back()->getName());
 
         // 清理并移除场景栈中所有场景
         while (!scene_stack_.empty()) {
@@ -9,6 +9,7 @@ namespace engine::core {
 }
 namespace engine::scene {
     class Scene;
+    class SceneLoader;
 }
 
 namespace engine::scene {
@@ -25,6 +26,9 @@ namespace engine::scene {
         PendingAction pending_action_ = PendingAction::None;    ///< @brief 待处理的动作
         std::unique_ptr<Scene> pending_scene_;                  ///< @brief 待处理场景
 
+        std::unique_ptr<SceneLoader> loader_;                   ///< @brief 正在后台加载的场景（没有则为空）
+        size_t texture_uploads_per_frame_ = 4;                  ///< @brief 异步加载时每帧最多上传的纹理数量
+
     public:
         explicit SceneManager(engine::core::Context& context);
         ~SceneManager();
@@ -40,6 +44,16 @@ namespace engine::scene {
         void requestPopScene();                                     ///< @brief 请求弹出当前场景。
         void requestReplaceScene(std::unique_ptr<Scene>&& scene);   ///< @brief 请求替换当前场景。
 
+        /**
+         * @brief 请求异步加载场景：在后台线程中准备 scene（见 Scene::prepare），完成后替换当前场景。
+         * @param scene 要加载的场景
+         * @param loading_scene 可选：加载期间显示的场景（立即替换当前场景）。为空则加载期间保持当前场景
+         */
+        void requestLoadScene(std::unique_ptr<Scene>&& scene, std::unique_ptr<Scene>&& loading_scene = nullptr);
+        bool isLoading() const { return loader_ != nullptr; }      ///< @brief 是否有场景正在后台加载
+        float getLoadProgress() const;                              ///< @brief 获取后台加载进度 [0, 1]，没有正在加载的场景时返回1
+        void setTextureUploadsPerFrame(size_t count) { texture_uploads_per_frame_ = count; }   ///< @brief 设置异步加载时每帧最多上传的纹理数量
+
         // getters
         Scene* getCurrentScene() const;                                 ///< @brief 获取当前活动场景（栈顶场景）的指针。
         engine::core::Context& getContext() const { return context_; }  ///< @brief 获取引擎上下文引用。
@@ -50,8 +64,15 @@ namespace engine::scene {
         void handleInput();
         void close();
 
+        /**
+         * @brief 渲染目标内容丢失（SDL_EVENT_RENDER_TARGETS_RESET / SDL_EVENT_RENDER_DEVICE_RESET）时调用，通知栈中所有场景。
+         * @param device_reset 渲染设备是否已重置（此时纹理本身也需要重新创建）
+         */
+        void onRenderTargetsReset(bool device_reset);
+
     private:
         void processPendingActions();                           ///< @brief 处理挂起的场景操作（每轮更新最后调用）。
+        void updateLoading();                                   ///< @brief 上传后台加载的纹理，完成后请求切换到加载好的场景。
         // 直接切换场景
         void pushScene(std::unique_ptr<Scene>&& scene);         ///< @brief 将一个新场景压入栈顶，使其成为活动场景。
         void popScene();                                        ///< @brief 移除栈顶场景。
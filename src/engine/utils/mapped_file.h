@@ -0,0 +1,39 @@
+#pragma once
+#include <cstddef>
+#include <string>
+
+namespace engine::utils {
+
+    /**
+     * @brief 只读内存映射文件（Windows 使用 CreateFileMapping，其它平台使用 mmap）。
+     *
+     * 打开后可以像访问内存数组一样读取文件内容，由操作系统按需分页载入，不需要整体读入缓冲区。
+     */
+    class MappedFile final {
+    private:
+        const std::byte* data_ = nullptr;   ///< @brief 映射后的文件内容
+        std::size_t size_ = 0;              ///< @brief 文件大小（字节）
+#ifdef _WIN32
+        void* file_handle_ = nullptr;       ///< @brief 文件句柄 (HANDLE)
+        void* mapping_handle_ = nullptr;    ///< @brief 映射对象句柄 (HANDLE)
+#endif
+
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        // 禁止拷贝和移动（持有操作系统句柄）
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&&) = delete;
+        MappedFile& operator=(MappedFile&&) = delete;
+
+        bool open(const std::string& file_path);    ///< @brief 映射文件，失败（文件不存在或为空等）返回 false
+        void close();                               ///< @brief 解除映射
+
+        bool isOpen() const { return data_ != nullptr; }    ///< @brief 是否已映射
+        const std::byte* data() const { return data_; }     ///< @brief 获取文件内容
+        std::size_t size() const { return size_; }          ///< @brief 获取文件大小
+    };
+
+} // namespace engine::utils
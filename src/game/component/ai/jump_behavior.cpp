@@ -43,7 +43,7 @@ namespace game::component::ai {
         auto is_on_ground = physics_component->hasCollidedBelow();      // 着地标志
         if (is_on_ground) {    // 如果在地面上
             jump_timer_ += delta_time;              // 增加跳跃计时器
-            physics_component->velocity_.x = 0.0f;  // 停止水平移动（否则会有惯性）
+            physics_component->setVelocityX(0.0f);  // 停止水平移动（否则会有惯性）
 
             if (jump_timer_ >= jump_interval_) {    // 时间到，准备跳跃
                 jump_timer_ = 0.0f; // 重置计时器
@@ -59,7 +59,7 @@ namespace game::component::ai {
                     jumping_right_ = true;
                 }
                 auto jump_vel_x = jumping_right_ ? jump_vel_.x : -jump_vel_.x;  // 确定水平跳跃方向
-                physics_component->velocity_ = { jump_vel_x, jump_vel_.y };        // 设置速度
+                physics_component->setVelocity({ jump_vel_x, jump_vel_.y });        // 设置速度
                 animation_component->playAnimation("jump");     // 播放跳跃动画
                 sprite_component->setFlipped(jumping_right_);   // 更新精灵翻转
 
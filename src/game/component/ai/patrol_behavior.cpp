@@ -42,12 +42,12 @@ namespace game::component::ai {
 
         // 撞右墙或到达设定目标则转向左
         if (physics_component->hasCollidedRight() || current_x >= patrol_max_x_) {
-            physics_component->velocity_.x = -move_speed_;
+            physics_component->setVelocityX(-move_speed_);
             moving_right_ = false;
             // 撞墙左或到达设定目标则转向右
         }
         else if (physics_component->hasCollidedLeft() || current_x <= patrol_min_x_) {
-            physics_component->velocity_.x = move_speed_;
+            physics_component->setVelocityX(move_speed_);
             moving_right_ = true;
         }
 
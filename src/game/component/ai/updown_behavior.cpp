@@ -45,12 +45,12 @@ namespace game::component::ai {
 
         // 到达上边界或碰到上方障碍，向下移动
         if (physics_component->hasCollidedAbove() || current_y <= patrol_min_y_) {
-            physics_component->velocity_.y = move_speed_;
+            physics_component->setVelocityY(move_speed_);
             moving_down_ = true;
             // 到达下边界或碰到下方障碍，向上移动
         }
         else if (physics_component->hasCollidedBelow() || current_y >= patrol_max_y_) {
-            physics_component->velocity_.y = -move_speed_;
+            physics_component->setVelocityY(-move_speed_);
             moving_down_ = false;
         }
         /* 不需要翻转精灵图 */
@@ -6,6 +6,7 @@
 #include "../../engine/component/sprite_component.h"
 #include "../../engine/component/animation_component.h"
 #include "../../engine/component/health_component.h"
+#include "../../engine/core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace game::component {
@@ -40,7 +41,7 @@ namespace game::component {
 
     void AIComponent::setBehavior(std::unique_ptr<ai::AIBehavior> behavior) {
         current_behavior_ = std::move(behavior);
-        spdlog::debug("GameObject '{}' 上的 AIComponent 设置了新的行为。", owner_ ? owner_->getName() : "Unknown");
+        ENGINE_LOG_DEBUG("GameObject '{}' 上的 AIComponent 设置了新的行为。", owner_ ? owner_->getName() : "Unknown");
         if (current_behavior_) {
             current_behavior_->enter(*this); // 调用新行为的 enter 方法
         }
@@ -11,6 +11,7 @@
 #include "../../engine/input/input_manager.h"
 #include <utility>
 #include <typeinfo>
+#include "../../engine/core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace game::component {
@@ -41,7 +42,7 @@ namespace game::component {
         else {
             spdlog::error("初始化玩家状态失败（make_unique 返回空指针）！");
         }
-        spdlog::debug("PlayerComponent 初始化完成。");
+        ENGINE_LOG_DEBUG("PlayerComponent 初始化完成。");
     }
 
     bool PlayerComponent::takeDamage(int damage) {
@@ -54,13 +55,13 @@ namespace game::component {
         if (!success) return false;
         // --- 成功造成伤害了，根据是否存活决定状态切换
         if (health_component_->isAlive()) {
-            spdlog::debug("玩家受到了 {} 点伤害，当前生命值: {}/{}。",
+            ENGINE_LOG_DEBUG("玩家受到了 {} 点伤害，当前生命值: {}/{}。",
                 damage, health_component_->getCurrentHealth(), health_component_->getMaxHealth());
             // 切换到受伤状态
             setState(std::make_unique<state::HurtState>(this));
         }
         else {
-            spdlog::debug("玩家死亡。");
+            ENGINE_LOG_DEBUG("玩家死亡。");
             is_dead_ = true;
             // 切换到死亡状态
             setState(std::make_unique<state::DeadState>(this));
@@ -78,7 +79,7 @@ namespace game::component {
         }
 
         current_state_ = std::move(new_state);
-        spdlog::debug("玩家组件正在切换到状态: {}", typeid(*current_state_).name());
+        ENGINE_LOG_DEBUG("玩家组件正在切换到状态: {}", typeid(*current_state_).name());
         current_state_->enter();
 
     }
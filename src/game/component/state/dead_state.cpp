@@ -4,16 +4,17 @@
 #include "../../../engine/component/animation_component.h"
 #include "../../../engine/component/physics_component.h"
 #include "../../../engine/component/collider_component.h"
+#include "../../../engine/core/log.h"
 
 namespace game::component::state {
 
     void DeadState::enter() {
-        spdlog::debug("玩家进入死亡状态。");
+        ENGINE_LOG_DEBUG("玩家进入死亡状态。");
         playAnimation("hurt");  // 播放死亡(受伤)动画
 
         // 应用击退力（只向上）
         auto physics_component = player_component_->getPhysicsComponent();
-        physics_component->velocity_ = glm::vec2(0.0f, -200.0f);  // 向上击退
+        physics_component->setVelocity(glm::vec2(0.0f, -200.0f));  // 向上击退
 
         // 禁用碰撞(自动掉出屏幕)
         auto collider_component = player_component_->getOwner()->getComponent<engine::component::ColliderComponent>();
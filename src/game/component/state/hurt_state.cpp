@@ -20,7 +20,7 @@ namespace game::component::state {
         if (sprite_component->isFlipped()) {
             knockback_velocity.x = -knockback_velocity.x;  // 变成向右
         }
-        physics_component->velocity_ = knockback_velocity;  // 设置击退速度
+        physics_component->setVelocity(knockback_velocity);  // 设置击退速度
 
     }
 
@@ -39,7 +39,7 @@ namespace game::component::state {
         // 1. 落地
         auto physics_component = player_component_->getPhysicsComponent();
         if (physics_component->hasCollidedBelow()) {
-            if (glm::abs(physics_component->velocity_.x) < 1.0f) {
+            if (glm::abs(physics_component->getVelocity().x) < 1.0f) {
                 return std::make_unique<IdleState>(player_component_);
             }
             else {
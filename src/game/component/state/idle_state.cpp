@@ -38,7 +38,7 @@ namespace game::component::state {
         // 应用摩擦力(水平方向)
         auto physics_component = player_component_->getPhysicsComponent();
         auto friction_factor = player_component_->getFrictionFactor();
-        physics_component->velocity_.x *= friction_factor;
+        physics_component->setVelocityX(physics_component->getVelocity().x * friction_factor);
 
         // 如果下方没有碰撞，则切换到 FallState
         if (!physics_component->hasCollidedBelow()) {
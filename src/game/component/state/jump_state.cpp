@@ -8,6 +8,7 @@
 #include "../../../engine/component/physics_component.h"
 #include "../../../engine/component/sprite_component.h"
 #include <glm/common.hpp>
+#include "../../../engine/core/log.h"
 #include <spdlog/spdlog.h>
 
 namespace game::component::state {
@@ -15,8 +16,8 @@ namespace game::component::state {
     void JumpState::enter() {
         playAnimation("jump");  // 播放跳跃动画
         auto physics_component = player_component_->getPhysicsComponent();
-        physics_component->velocity_.y = -player_component_->getJumpVelocity();     // 向上跳跃
-        spdlog::debug("PlayerComponent 进入 JumpState，设置初始垂直速度为: {}", physics_component->velocity_.y);
+        physics_component->setVelocityY(-player_component_->getJumpVelocity());     // 向上跳跃
+        ENGINE_LOG_DEBUG("PlayerComponent 进入 JumpState，设置初始垂直速度为: {}", physics_component->getVelocity().y);
     }
 
     void JumpState::exit() {
@@ -31,12 +32,12 @@ namespace game::component::state {
 
         // 跳跃状态下可以左右移动
         if (input_manager.isActionDown("move_left")) {
-            if (physics_component->velocity_.x > 0.0f) physics_component->velocity_.x = 0.0f;
+            if (physics_component->getVelocity().x > 0.0f) physics_component->setVelocityX(0.0f);
             physics_component->addForce({ -player_component_->getMoveForce(), 0.0f });
             sprite_component->setFlipped(true);
         }
         else if (input_manager.isActionDown("move_right")) {
-            if (physics_component->velocity_.x < 0.0f) physics_component->velocity_.x = 0.0f;
+            if (physics_component->getVelocity().x < 0.0f) physics_component->setVelocityX(0.0f);
             physics_component->addForce({ player_component_->getMoveForce(), 0.0f });
             sprite_component->setFlipped(false);
         }
@@ -48,10 +49,10 @@ namespace game::component::state {
         // 限制最大速度(水平方向)
         auto physics_component = player_component_->getPhysicsComponent();
         auto max_speed = player_component_->getMaxSpeed();
-        physics_component->velocity_.x = glm::clamp(physics_component->velocity_.x, -max_speed, max_speed);
+        physics_component->setVelocityX(glm::clamp(physics_component->getVelocity().x, -max_speed, max_speed));
 
         // 如果速度为正，切换到 FallState
-        if (physics_component->velocity_.y > 0.0f) {
+        if (physics_component->getVelocity().y > 0.0f) {
             return std::make_unique<FallState>(player_component_);
         }
 
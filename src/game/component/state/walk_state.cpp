@@ -34,16 +34,16 @@ namespace game::component::state {
 
         // 步行状态可以左右移动
         if (input_manager.isActionDown("move_left")) {
-            if (physics_component->velocity_.x > 0.0f) {
-                physics_component->velocity_.x = 0.0f;  // 如果当前速度是向右的，则先减速到0 (增强操控手感)
+            if (physics_component->getVelocity().x > 0.0f) {
+                physics_component->setVelocityX(0.0f);  // 如果当前速度是向右的，则先减速到0 (增强操控手感)
             }
             // 添加向左的水平力
             physics_component->addForce({ -player_component_->getMoveForce(), 0.0f });
             sprite_component->setFlipped(true);         // 向左移动时翻转
         }
         else if (input_manager.isActionDown("move_right")) {
-            if (physics_component->velocity_.x < 0.0f) {
-                physics_component->velocity_.x = 0.0f;  // 如果当前速度是向左的，则先减速到0
+            if (physics_component->getVelocity().x < 0.0f) {
+                physics_component->setVelocityX(0.0f);  // 如果当前速度是向左的，则先减速到0
             }
             // 添加向右的水平力
             physics_component->addForce({ player_component_->getMoveForce(), 0.0f });
@@ -61,7 +61,7 @@ namespace game::component::state {
         // 限制最大速度
         auto physics_component = player_component_->getPhysicsComponent();
         auto max_speed = player_component_->getMaxSpeed();
-        physics_component->velocity_.x = glm::clamp(physics_component->velocity_.x, -max_speed, max_speed);
+        physics_component->setVelocityX(glm::clamp(physics_component->getVelocity().x, -max_speed, max_speed));
 
         // 如果下方没有碰撞，则切换到 FallState
         if (!physics_component->hasCollidedBelow()) {
@@ -1,13 +1,24 @@
 #include "game_scene.h"
 #include "../../engine/core/context.h"
 #include "../../engine/object/game_object.h"
+#include "../../engine/object/component_registry.h"
 #include "../../engine/component/transform_component.h"
 #include "../../engine/component/sprite_component.h"
 #include "../../engine/component/physics_component.h"
+#include "../../engine/component/collider_component.h"
+#include "../../engine/component/animation_component.h"
+#include "../../engine/component/health_component.h"
+#include "../../engine/component/parallax_component.h"
+#include "../../engine/component/tilelayer_component.h"
+#include "../component/ai_component.h"
+#include "../component/player_component.h"
 #include "../../engine/physics/physics_engine.h"
 #include "../../engine/scene/level_loader.h"
+#include "../../engine/scene/scene_loader.h"
+#include "../../engine/resource/resource_manager.h"
 #include "../../engine/input/input_manager.h"
 #include "../../engine/render/camera.h"
+#include "../../engine/core/log.h"
 #include <spdlog/spdlog.h>
 #include <SDL3/SDL_rect.h>
 
@@ -16,19 +27,53 @@ namespace game::scene {
     // 构造函数：调用基类构造函数
     GameScene::GameScene(std::string name, engine::core::Context& context, engine::scene::SceneManager& scene_manager)
         : Scene(name, context, scene_manager) {
-        spdlog::trace("GameScene 构造完成。");
+        registerComponentSystems();
+        ENGINE_LOG_TRACE("GameScene 构造完成。");
+    }
+
+    namespace {
+        constexpr const char* LEVEL_PATH = "assets/maps/level1.tmj";
+        constexpr const char* TEST_OBJECT_TEXTURE = "assets/textures/Props/big-crate.png";
+    }
+
+    void GameScene::prepare(engine::scene::SceneLoader& loader) {
+        // 工作线程：准备关卡数据并解码关卡用到的所有图片
+        engine::scene::LevelLoader level_loader;
+        if (!level_loader.prepareLevel(LEVEL_PATH, level_data_)) {
+            return;
+        }
+        level_prepared_ = true;
+        // 预加载清单：关卡（图块集及对象）用到的纹理，加上场景自己创建的对象用到的纹理
+        auto manifest = engine::scene::LevelLoader::collectTexturePaths(level_data_);
+        manifest.push_back(TEST_OBJECT_TEXTURE);
+        loader.decodeTextures(manifest);
     }
 
     void GameScene::init() {
         // 加载关卡（level_loader通常加载完成后即可销毁，因此不存为成员变量）
         engine::scene::LevelLoader level_loader;
-        level_loader.loadLevel("assets/maps/level1.tmj", *this);
+        if (level_prepared_) {
+            // 已在后台准备好（纹理也已上传），只需创建对象
+            level_loader.buildLevel(level_data_, *this);
+            level_data_ = engine::scene::LevelData{};
+            level_prepared_ = false;
+        }
+        else if (engine::scene::LevelData data; level_loader.prepareLevel(LEVEL_PATH, data)) {
+            // 同步加载：先按清单预加载纹理（并行解码、一次性上传），避免创建对象时逐个读盘
+            auto manifest = engine::scene::LevelLoader::collectTexturePaths(data);
+            manifest.push_back(TEST_OBJECT_TEXTURE);
+            context_.getResourceManager().preloadTextures(manifest);
+            level_loader.buildLevel(data, *this);
+        }
+        else {
+            spdlog::error("关卡加载失败: {}", LEVEL_PATH);
+        }
 
         // 创建 test_object
         createTestObject();
 
         Scene::init();
-        spdlog::trace("GameScene 初始化完成。");
+        ENGINE_LOG_TRACE("GameScene 初始化完成。");
     }
 
     void GameScene::update(float delta_time) {
@@ -48,21 +93,39 @@ namespace game::scene {
         Scene::clean();
     }
 
+    void GameScene::registerComponentSystems() {
+        using engine::object::ComponentPhase;
+        auto& registry = getComponentRegistry();
+        // 有逻辑的组件按固定顺序集中更新：动画 -> AI -> 玩家 -> 生命值
+        registry.registerSystem<engine::component::AnimationComponent>(ComponentPhase::UPDATE);
+        registry.registerSystem<game::component::AIComponent>(ComponentPhase::UPDATE);
+        registry.registerSystem<game::component::PlayerComponent>(ComponentPhase::INPUT | ComponentPhase::UPDATE);
+        registry.registerSystem<engine::component::HealthComponent>(ComponentPhase::UPDATE);
+        // 只渲染的组件（渲染仍逐对象进行以保持绘制顺序）
+        registry.registerSystem<engine::component::SpriteComponent>(ComponentPhase::RENDER);
+        registry.registerSystem<engine::component::ParallaxComponent>(ComponentPhase::RENDER);
+        registry.registerSystem<engine::component::TileLayerComponent>(ComponentPhase::RENDER);
+        // 纯数据组件，不参与任何阶段 (物理由 PhysicsEngine 处理)
+        registry.registerSystem<engine::component::TransformComponent>(ComponentPhase::NONE);
+        registry.registerSystem<engine::component::PhysicsComponent>(ComponentPhase::NONE);
+        registry.registerSystem<engine::component::ColliderComponent>(ComponentPhase::NONE);
+    }
+
     // --- 测试方法 ---
 
     void GameScene::createTestObject() {
-        spdlog::trace("在 GameScene 中创建 test_object...");
+        ENGINE_LOG_TRACE("在 GameScene 中创建 test_object...");
         auto test_object = std::make_unique<engine::object::GameObject>("test_object");
         test_object_ = test_object.get();
 
         // 添加组件
         test_object->addComponent<engine::component::TransformComponent>(glm::vec2(100.0f, 100.0f));
-        test_object->addComponent<engine::component::SpriteComponent>("assets/textures/Props/big-crate.png", context_.getResourceManager());
+        test_object->addComponent<engine::component::SpriteComponent>(TEST_OBJECT_TEXTURE, context_.getResourceManager());
         test_object->addComponent<engine::component::PhysicsComponent>(&context_.getPhysicsEngine());
 
         // 将创建好的 GameObject 添加到场景中 （一定要用std::move，否则传递的是左值）
         addGameObject(std::move(test_object));
-        spdlog::trace("test_object 创建并添加到 GameScene 中。");
+        ENGINE_LOG_TRACE("test_object 创建并添加到 GameScene 中。");
     }
 
     void GameScene::testCamera() {
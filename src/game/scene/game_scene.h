@@ -1,5 +1,6 @@
 #pragma once
 #include "../../engine/scene/scene.h"
+#include "../../engine/scene/level_data.h"
 #include <memory>
 
 // 前置声明
@@ -18,6 +19,7 @@ namespace game::scene {
         GameScene(std::string name, engine::core::Context& context, engine::scene::SceneManager& scene_manager);
 
         // 覆盖场景基类的核心方法
+        void prepare(engine::scene::SceneLoader& loader) override;
         void init() override;
         void update(float delta_time) override;
         void render() override;
@@ -25,6 +27,10 @@ namespace game::scene {
         void clean() override;
 
     private:
+        engine::scene::LevelData level_data_;   ///< @brief 后台准备好的关卡数据（init 中据此创建对象后释放）
+        bool level_prepared_ = false;           ///< @brief level_data_ 是否已准备好（否则 init 中同步加载关卡）
+
+        void registerComponentSystems();    ///< @brief 登记组件系统及各组件类型参与的阶段（构造时调用）
 
         // test 
         engine::object::GameObject* test_object_ = nullptr;  ///< @brief 保存测试对象的指针，方便访问
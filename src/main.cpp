@@ -1,9 +1,12 @@
 #include "engine/core/game_app.h"
-#include <spdlog/spdlog.h>
+#include "engine/core/log.h"
 
 int main(int /* argc */, char* /* argv */[]) {
-    spdlog::set_level(spdlog::level::debug);
-    engine::core::GameApp app;
-    app.run();
+    engine::core::initLogging(spdlog::level::debug);
+    {
+        engine::core::GameApp app;
+        app.run();
+    }
+    engine::core::shutdownLogging();
     return 0;
-}
\ No newline at end of file
+}